@@ -0,0 +1,90 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <vector>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/containers/xadapt.hpp>
+#include <xtensor/views/xview.hpp>
+
+#include "oiseau/dg/dg_space.hpp"
+#include "oiseau/dg/nodal/element.hpp"
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/test_meshes.hpp"
+
+using namespace oiseau;
+
+namespace {
+std::atomic<std::size_t> n_allocations{0};
+}  // namespace
+
+void* operator new(std::size_t size) {
+  n_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+  throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+// DGSpace element construction with the vertex-to-node map V_n(r) V_1^-1 recomputed for every
+// cell, as it was before the map was cached per (type, order). Both benchmarks build the same
+// elements and report heap allocations per cell through the counting operator new above.
+void RecomputedVertexMap(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const mesh::Mesh mesh = test::grid_mesh(mesh::CellKind::Triangle, n, 2);
+  const auto& x = mesh.geometry().x();
+  std::array<std::size_t, 2> shape = {x.size() / 2, 2};
+  auto nodes = xt::adapt(x.data(), x.size(), xt::no_ownership(), shape);
+  auto interp_elem = dg::nodal::get_ref_element(dg::nodal::RefElementType::Triangle, 1);
+  auto ref_elem = dg::nodal::get_ref_element(dg::nodal::RefElementType::Triangle, 4);
+
+  const std::size_t before = n_allocations;
+  for (auto _ : state) {
+    std::vector<dg::nodal::Element> elements;
+    elements.reserve(mesh.topology().n_cells());
+    for (const auto& cell : mesh.topology().conn()) {
+      auto x_view = xt::view(nodes, xt::keep(cell), xt::all());
+      auto inv_v = xt::linalg::inv(interp_elem->v());
+      auto v = interp_elem->vandermonde(ref_elem->r());
+      elements.emplace_back(ref_elem, xt::linalg::dot(xt::linalg::dot(v, inv_v), x_view));
+    }
+    benchmark::DoNotOptimize(elements);
+  }
+  const auto n_cells = static_cast<double>(mesh.topology().n_cells());
+  state.counters["allocs/cell"] =
+      static_cast<double>(n_allocations - before) / (state.iterations() * n_cells);
+  state.SetItemsProcessed(state.iterations() * mesh.topology().n_cells());
+}
+BENCHMARK(RecomputedVertexMap)->Arg(32)->Arg(128)->Unit(benchmark::kMillisecond);
+
+void CachedVertexMap(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const mesh::Mesh mesh = test::grid_mesh(mesh::CellKind::Triangle, n, 2);
+  const std::vector<unsigned> orders(mesh.topology().n_cells(), 4);
+  dg::DGSpace warm(mesh, orders);
+
+  const std::size_t before = n_allocations;
+  for (auto _ : state) {
+    dg::DGSpace space(mesh, orders);
+    benchmark::DoNotOptimize(space);
+  }
+  const auto n_cells = static_cast<double>(mesh.topology().n_cells());
+  state.counters["allocs/cell"] =
+      static_cast<double>(n_allocations - before) / (state.iterations() * n_cells);
+  state.SetItemsProcessed(state.iterations() * mesh.topology().n_cells());
+}
+BENCHMARK(CachedVertexMap)->Arg(32)->Arg(128)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,33 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/refine.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/test_meshes.hpp"
+
+using namespace oiseau::mesh;
+
+void RefineTetrahedra(benchmark::State& state) {
+  // n^3 cubes, each split into 6 tetrahedra along its main diagonal (Kuhn subdivision).
+  const Mesh mesh =
+      oiseau::test::grid_mesh(CellKind::Tetrahedron, static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    Mesh refined = refine_uniform(mesh);
+    benchmark::DoNotOptimize(refined);
+  }
+  state.SetItemsProcessed(state.iterations() * mesh.topology().n_cells());
+}
+BENCHMARK(RefineTetrahedra)->Arg(16)->Arg(32)->Arg(56)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,86 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/reorder.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/test_meshes.hpp"
+
+using namespace oiseau::mesh;
+
+// Nodal values per cell, roughly a 2D element of order 4.
+constexpr std::size_t NP = 15;
+
+// n x n quadrilateral grid on the unit square with cells and nodes randomly shuffled.
+Mesh shuffled_quad_mesh(std::size_t n) {
+  return oiseau::test::shuffled_mesh(oiseau::test::grid_mesh(CellKind::Quadrilateral, n));
+}
+
+// Face-neighbour traversal as in a DG flux loop: every cell reads its neighbours' values.
+void NeighbourTraversal(benchmark::State& state) {
+  Mesh mesh = shuffled_quad_mesh(static_cast<std::size_t>(state.range(0)));
+  switch (state.range(1)) {
+    case 1:
+      reorder(mesh, ReorderMethod::ReverseCuthillMcKee);
+      break;
+    case 2:
+      reorder(mesh, ReorderMethod::Hilbert);
+      break;
+    case 3:
+      reorder(mesh, ReorderMethod::Morton);
+      break;
+    default:
+      mesh.topology().calculate_connectivity();
+  }
+  const auto e_to_e = mesh.topology().e_to_e();
+  const std::size_t n_cells = mesh.topology().n_cells();
+  std::vector<double> u(n_cells * NP, 1.0);
+  std::vector<double> rhs(n_cells * NP, 0.0);
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < n_cells; i++) {
+      for (auto k : e_to_e[i]) {
+        for (std::size_t p = 0; p < NP; p++) rhs[i * NP + p] += u[k * NP + p] - u[i * NP + p];
+      }
+    }
+    benchmark::DoNotOptimize(rhs.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n_cells);
+}
+// second argument: 0 = shuffled, 1 = RCM, 2 = Hilbert, 3 = Morton
+BENCHMARK(NeighbourTraversal)
+    ->ArgsProduct({{64, 256, 1024}, {0, 1, 2, 3}})
+    ->ArgNames({"n", "order"})
+    ->Unit(benchmark::kMicrosecond);
+
+void Reorder(benchmark::State& state) {
+  const Mesh original = shuffled_quad_mesh(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Mesh mesh = original;
+    mesh.topology().calculate_connectivity();
+    state.ResumeTiming();
+    auto perm = reorder(mesh, static_cast<ReorderMethod>(state.range(1)));
+    benchmark::DoNotOptimize(perm);
+  }
+}
+// second argument: 0 = RCM, 1 = Hilbert, 2 = Morton
+BENCHMARK(Reorder)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->ArgNames({"n", "method"})
+    ->Unit(benchmark::kMillisecond);
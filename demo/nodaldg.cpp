@@ -4,4 +4,284 @@
 //
 // SPDX-License-Identifier: GPL-3.0-or-later
 
-int main() { return 0; }
+// 2D linear advection u_t + a . grad(u) = 0 with a nodal DG discretisation and upwind fluxes.
+// It is kept as the reference workload for profiling the library:
+//
+//   oiseau_nodaldg [mesh.msh] [order] [refinements] [t_final]
+//
+// Cells are assumed affine (quadrilaterals as parallelograms), as in nodal::affine_jacobian.
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <string>
+#include <vector>
+#include <xtensor/containers/xarray.hpp>
+
+#include "oiseau/dg/dg_space.hpp"
+#include "oiseau/dg/local_time_stepping.hpp"
+#include "oiseau/dg/nodal/element.hpp"
+#include "oiseau/dg/nodal/operators.hpp"
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/dg/time_integration.hpp"
+#include "oiseau/io/gmsh.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/refine.hpp"
+
+using namespace oiseau;
+
+namespace {
+
+constexpr std::array<double, 2> VELOCITY = {1.0, 0.5};
+constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Gaussian pulse carried by the flow
+struct Pulse {
+  std::array<double, 2> center;
+  double width;
+
+  double operator()(double x, double y, double t) const {
+    const double dx = x - center[0] - VELOCITY[0] * t;
+    const double dy = y - center[1] - VELOCITY[1] * t;
+    return std::exp(-(dx * dx + dy * dy) / (width * width));
+  }
+};
+
+class Advection {
+ public:
+  Advection(const dg::DGSpace &space, Pulse pulse);
+
+  std::size_t n_dofs() const { return m_offsets.back(); }
+  std::span<const std::array<double, 2>> x() const { return m_x; }
+  double stable_dt(double cfl) const { return m_stable_dt * cfl; }
+
+  void rhs(double t, std::span<const double> u, std::span<double> dudt) const;
+
+ private:
+  std::vector<const dg::nodal::RefOperators *> m_ops;
+  std::vector<const dg::nodal::RefElement *> m_ref;
+  std::vector<std::size_t> m_offsets;
+  // velocity in reference coordinates, (a . grad r, a . grad s)
+  std::vector<std::array<double, 2>> m_velocity;
+  // a . n and |face| / |cell| scaling, per face; neighbour dof of every face node
+  std::vector<std::size_t> m_face_offsets;
+  std::vector<double> m_normal_velocity;
+  std::vector<double> m_face_scale;
+  std::vector<std::size_t> m_node_offsets;
+  std::vector<std::size_t> m_outside;
+  std::vector<std::array<double, 2>> m_x;
+  std::size_t m_max_face_nodes = 0;
+  double m_stable_dt = std::numeric_limits<double>::max();
+  Pulse m_pulse;
+};
+
+Advection::Advection(const dg::DGSpace &space, Pulse pulse) : m_pulse(pulse) {
+  const auto &mesh = space.mesh();
+  const auto &topology = mesh.topology();
+  const auto &geometry = mesh.geometry();
+  const auto elements = space.elements();
+  const std::size_t n_cells = elements.size();
+  m_offsets.assign(space.offsets().begin(), space.offsets().end());
+  m_x.resize(n_dofs());
+
+  const double speed = std::hypot(VELOCITY[0], VELOCITY[1]);
+  std::vector<std::array<double, 2>> centroids(n_cells);
+  std::vector<double> det(n_cells);
+  for (std::size_t e = 0; e < n_cells; e++) {
+    const auto &ref = elements[e].reference();
+    const auto &conn = topology.conn()[e];
+    m_ref.push_back(&ref);
+    m_ops.push_back(&dg::nodal::ref_operators(ref.type(), ref.order()));
+
+    xt::xarray<double> vertices = xt::zeros<double>(std::vector<std::size_t>{conn.size(), 2});
+    for (std::size_t v = 0; v < conn.size(); v++) {
+      auto xv = geometry.x_at(conn[v]);
+      vertices(v, 0) = xv[0];
+      vertices(v, 1) = xv[1];
+      centroids[e][0] += xv[0] / conn.size();
+      centroids[e][1] += xv[1] / conn.size();
+    }
+    auto jac = dg::nodal::affine_jacobian(ref.type(), vertices);
+    det[e] = jac(0, 0) * jac(1, 1) - jac(0, 1) * jac(1, 0);
+    const std::array<double, 4> inv = {jac(1, 1) / det[e], -jac(0, 1) / det[e],
+                                       -jac(1, 0) / det[e], jac(0, 0) / det[e]};
+    m_velocity.push_back({inv[0] * VELOCITY[0] + inv[1] * VELOCITY[1],
+                          inv[2] * VELOCITY[0] + inv[3] * VELOCITY[1]});
+
+    const auto &nodes = elements[e].nodes();
+    for (std::size_t i = 0; i < nodes.shape()[0]; i++) {
+      for (std::size_t k = 0; k < 2; k++) m_x[m_offsets[e] + i][k] = nodes(i, k);
+    }
+    m_stable_dt = std::min(m_stable_dt, dg::stable_time_step(elements[e], 1.0, speed));
+  }
+
+  // outward normals from the cell vertices; outside values matched by node coordinates
+  m_face_offsets.push_back(0);
+  m_node_offsets.push_back(0);
+  for (std::size_t e = 0; e < n_cells; e++) {
+    const auto &conn = topology.conn()[e];
+    const auto faces = topology.cell_types()[e]->get_entity_vertices(1);
+    const auto &ops = *m_ops[e];
+    for (std::size_t f = 0; f < faces.size(); f++) {
+      auto xa = geometry.x_at(conn[faces[f][0]]);
+      auto xb = geometry.x_at(conn[faces[f][1]]);
+      const double length = std::hypot(xb[0] - xa[0], xb[1] - xa[1]);
+      std::array<double, 2> n = {(xb[1] - xa[1]) / length, -(xb[0] - xa[0]) / length};
+      const double side = n[0] * (0.5 * (xa[0] + xb[0]) - centroids[e][0]) +
+                          n[1] * (0.5 * (xa[1] + xb[1]) - centroids[e][1]);
+      if (side < 0.0) n = {-n[0], -n[1]};
+      m_normal_velocity.push_back(n[0] * VELOCITY[0] + n[1] * VELOCITY[1]);
+      m_face_scale.push_back(0.5 * length / std::abs(det[e]));
+
+      const std::size_t k = topology.e_to_e()[e][f];
+      const std::size_t g = topology.e_to_f()[e][f];
+      for (auto i : ops.face_nodes[f]) {
+        if (k == e) {
+          m_outside.push_back(NONE);
+          continue;
+        }
+        const auto &xi = m_x[m_offsets[e] + i];
+        std::size_t best = NONE;
+        double best_distance = std::numeric_limits<double>::max();
+        for (auto j : m_ops[k]->face_nodes[g]) {
+          const auto &xj = m_x[m_offsets[k] + j];
+          const double distance = std::hypot(xj[0] - xi[0], xj[1] - xi[1]);
+          if (distance < best_distance) {
+            best_distance = distance;
+            best = m_offsets[k] + j;
+          }
+        }
+        m_outside.push_back(best);
+      }
+      m_node_offsets.push_back(m_outside.size());
+    }
+    m_face_offsets.push_back(m_normal_velocity.size());
+    m_max_face_nodes = std::max(m_max_face_nodes, faces.size() * m_ref[e]->number_of_face_nodes());
+  }
+}
+
+void Advection::rhs(double t, std::span<const double> u, std::span<double> dudt) const {
+  const std::size_t n_cells = m_ops.size();
+#pragma omp parallel
+  {
+    std::vector<double> flux(m_max_face_nodes);
+#pragma omp for
+    for (std::size_t e = 0; e < n_cells; e++) {
+      const auto &ops = *m_ops[e];
+      const std::size_t np = m_ref[e]->number_of_nodes();
+      const std::size_t nfp = m_ref[e]->number_of_face_nodes();
+      const std::size_t n_faces = ops.face_nodes.size();
+      const double *ue = u.data() + m_offsets[e];
+      double *re = dudt.data() + m_offsets[e];
+
+      // -a . grad(u); d() stores d l_j / d r_k at (i, j, k)
+      const double *d = m_ref[e]->d().data();
+      const auto [ar, as] = m_velocity[e];
+      for (std::size_t i = 0; i < np; i++) {
+        double dr = 0.0, ds = 0.0;
+        for (std::size_t j = 0; j < np; j++) {
+          dr += d[2 * (i * np + j)] * ue[j];
+          ds += d[2 * (i * np + j) + 1] * ue[j];
+        }
+        re[i] = -(ar * dr + as * ds);
+      }
+
+      // upwind flux jumps, (a . n) u- - (a . n u)* = min(a . n, 0) (u- - u+)
+      for (std::size_t f = 0; f < n_faces; f++) {
+        const std::size_t face = m_face_offsets[e] + f;
+        const double an = std::min(m_normal_velocity[face], 0.0) * m_face_scale[face];
+        for (std::size_t j = 0; j < nfp; j++) {
+          const std::size_t i = ops.face_nodes[f][j];
+          const std::size_t outside = m_outside[m_node_offsets[face] + j];
+          const auto &xi = m_x[m_offsets[e] + i];
+          const double u_out = outside == NONE ? m_pulse(xi[0], xi[1], t) : u[outside];
+          flux[f * nfp + j] = an * (ue[i] - u_out);
+        }
+      }
+      const double *lift = ops.lift.data();
+      const std::size_t n_flux = n_faces * nfp;
+      for (std::size_t i = 0; i < np; i++) {
+        double sum = 0.0;
+        for (std::size_t k = 0; k < n_flux; k++) sum += lift[i * n_flux + k] * flux[k];
+        re[i] += sum;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  const std::string path = argc > 1 ? argv[1] : "demo/meshes/mesh.msh";
+  const unsigned order = argc > 2 ? std::stoul(argv[2]) : 4;
+  const unsigned refinements = argc > 3 ? std::stoul(argv[3]) : 1;
+  const double t_final = argc > 4 ? std::stod(argv[4]) : 0.5;
+
+  mesh::Mesh mesh = io::gmsh_read_from_path(path);
+  for (unsigned k = 0; k < refinements; k++) mesh = mesh::refine_uniform(mesh);
+  mesh.topology().calculate_connectivity();
+
+  // the pulse crosses the middle of the mesh
+  const auto &geometry = mesh.geometry();
+  std::array<double, 2> lo = {std::numeric_limits<double>::max(),
+                              std::numeric_limits<double>::max()};
+  std::array<double, 2> hi = {-lo[0], -lo[1]};
+  for (std::size_t v = 0; v < geometry.n_nodes(); v++) {
+    auto xv = geometry.x_at(v);
+    for (std::size_t k = 0; k < 2; k++) {
+      lo[k] = std::min(lo[k], xv[k]);
+      hi[k] = std::max(hi[k], xv[k]);
+    }
+  }
+  Pulse pulse{{0.5 * (lo[0] + hi[0] - VELOCITY[0] * t_final),
+               0.5 * (lo[1] + hi[1] - VELOCITY[1] * t_final)},
+              0.1 * std::min(hi[0] - lo[0], hi[1] - lo[1])};
+
+  const auto setup_start = std::chrono::steady_clock::now();
+  dg::DGSpace space(mesh, std::vector<unsigned>(mesh.topology().n_cells(), order));
+  Advection advection(space, pulse);
+  std::vector<double> u(advection.n_dofs());
+  for (std::size_t i = 0; i < u.size(); i++) {
+    u[i] = pulse(advection.x()[i][0], advection.x()[i][1], 0.0);
+  }
+  const double setup = seconds_since(setup_start);
+
+  dg::LowStorageRK rk(dg::RKScheme::LSERK4, u.size());
+  const double dt = advection.stable_dt(0.5);
+  auto rhs = [&](double t, std::span<const double> v, std::span<double> dvdt) {
+    advection.rhs(t, v, dvdt);
+  };
+  const auto start = std::chrono::steady_clock::now();
+  const std::size_t n_steps = rk.integrate(rhs, 0.0, t_final, dt, u);
+  const double wall = seconds_since(start);
+
+  double error = 0.0;
+  for (std::size_t i = 0; i < u.size(); i++) {
+    error = std::max(error, std::abs(u[i] - pulse(advection.x()[i][0], advection.x()[i][1],
+                                                  t_final)));
+  }
+
+  fmt::print("mesh        {}\n", path);
+  fmt::print("cells       {}\n", mesh.topology().n_cells());
+  fmt::print("order       {}\n", order);
+  fmt::print("dofs        {}\n", u.size());
+  fmt::print("dt          {:.3e}\n", dt);
+  fmt::print("steps       {}\n", n_steps);
+  fmt::print("setup       {:.3f} s\n", setup);
+  fmt::print("wall time   {:.3f} s\n", wall);
+  fmt::print("steps/s     {:.1f}\n", n_steps / wall);
+  fmt::print("dof-stages  {:.3e} /s\n",
+             static_cast<double>(u.size()) * n_steps * rk.n_stages() / wall);
+  fmt::print("max error   {:.3e}\n", error);
+  return 0;
+}
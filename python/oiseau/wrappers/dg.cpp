@@ -0,0 +1,55 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "oiseau/dg/dg_space.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "views.hpp"
+
+namespace py = pybind11;
+
+namespace oiseau::wrappers {
+void dg(py::module &m) {
+  py::class_<dg::DGSpace> space(m, "DGSpace");
+  // the space keeps a pointer to the mesh; building the elements runs without the GIL
+  space.def(py::init<const mesh::Mesh &, const std::vector<unsigned> &>(), py::arg("mesh"),
+            py::arg("orders"), py::keep_alive<1, 2>(), py::call_guard<py::gil_scoped_release>());
+  space.def("n_dofs", &dg::DGSpace::n_dofs);
+  space.def(
+      "orders",
+      [](py::object self) {
+        auto orders = self.cast<const dg::DGSpace &>().orders();
+        return view(orders, {static_cast<py::ssize_t>(orders.size())}, self);
+      },
+      "Order of each element, as a read-only array sharing memory with the space.");
+  space.def(
+      "offsets",
+      [](py::object self) {
+        auto offsets = self.cast<const dg::DGSpace &>().offsets();
+        return view(offsets, {static_cast<py::ssize_t>(offsets.size())}, self);
+      },
+      "First degree of freedom of each element followed by the total, as a read-only array.");
+  space.def(
+      "element_nodes",
+      [](py::object self, std::size_t i) {
+        auto elements = self.cast<const dg::DGSpace &>().elements();
+        if (i >= elements.size()) throw std::out_of_range("Element index out of range");
+        const auto &nodes = elements[i].nodes();
+        const auto n_nodes = static_cast<py::ssize_t>(nodes.shape()[0]);
+        const auto gdim = static_cast<py::ssize_t>(nodes.shape()[1]);
+        return view(std::span<const double>(nodes.data(), nodes.size()), {n_nodes, gdim}, self);
+      },
+      py::arg("i"), "Nodes of element i as a read-only (n_nodes, gdim) array, without copying.");
+}
+}  // namespace oiseau::wrappers
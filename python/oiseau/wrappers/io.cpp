@@ -5,9 +5,22 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl/filesystem.h>
+
+#include <filesystem>
+#include <string>
+
+#include "oiseau/io/gmsh.hpp"
 
 namespace py = pybind11;
 
 namespace oiseau::wrappers {
-void io(py::module &m) {}
+void io(py::module &m) {
+  // parsing only touches the new mesh, so other Python threads may run meanwhile
+  m.def("gmsh_read_from_path", &io::gmsh_read_from_path, py::arg("path"),
+        py::call_guard<py::gil_scoped_release>(), "Reads a Gmsh .msh file into a Mesh.");
+  m.def("gmsh_read_from_string", &io::gmsh_read_from_string, py::arg("string"),
+        py::call_guard<py::gil_scoped_release>(),
+        "Reads the contents of a Gmsh .msh file into a Mesh.");
+}
 }  // namespace oiseau::wrappers
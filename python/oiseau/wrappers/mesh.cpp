@@ -9,10 +9,17 @@
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
+#include <cstddef>
 #include <memory>
+#include <span>
+#include <stdexcept>
 #include <vector>
 
 #include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "views.hpp"
 
 namespace py = pybind11;
 
@@ -29,6 +36,76 @@ void mesh(py::module &m) {
       },
       py::arg("dim"), "Get entity vertices.");
   m.def("get_cell_type", &mesh::get_cell_type);
+
+  py::class_<mesh::Geometry> geometry(m, "Geometry");
+  geometry.def("dim", &mesh::Geometry::dim);
+  geometry.def("n_nodes", &mesh::Geometry::n_nodes);
+  geometry.def(
+      "x",
+      [](py::object self) {
+        auto &g = self.cast<mesh::Geometry &>();
+        const auto n_nodes = static_cast<py::ssize_t>(g.n_nodes());
+        return view(g.x(), {n_nodes, static_cast<py::ssize_t>(g.dim())}, self);
+      },
+      "Node coordinates as an (n_nodes, dim) array sharing memory with the geometry.");
+
+  py::class_<mesh::Topology> topology(m, "Topology");
+  topology.def("n_cells", &mesh::Topology::n_cells);
+  topology.def("calculate_connectivity", &mesh::Topology::calculate_connectivity,
+               py::call_guard<py::gil_scoped_release>());
+  topology.def("cell_types", [](const mesh::Topology &self) {
+    py::list types;
+    for (auto type : self.cell_types()) {
+      types.append(py::cast(type, py::return_value_policy::reference));
+    }
+    return types;
+  });
+  topology.def(
+      "cell_tags",
+      [](py::object self) {
+        auto tags = self.cast<mesh::Topology &>().cell_tags();
+        return view(tags, {static_cast<py::ssize_t>(tags.size())}, self);
+      },
+      "Physical tag of each cell, sharing memory with the topology.");
+  topology.def(
+      "conn",
+      [](const mesh::Topology &self) {
+        // cells are stored as separate vectors, so they are packed once into a single buffer
+        auto conn = self.conn();
+        const std::size_t nv = conn.empty() ? 0 : conn[0].size();
+        std::vector<std::size_t> packed;
+        packed.reserve(conn.size() * nv);
+        for (const auto &cell : conn) {
+          if (cell.size() != nv) {
+            throw std::invalid_argument("Cells have different numbers of vertices, use conn_csr");
+          }
+          packed.insert(packed.end(), cell.begin(), cell.end());
+        }
+        return adopt(std::move(packed), {static_cast<py::ssize_t>(conn.size()),
+                                         static_cast<py::ssize_t>(nv)});
+      },
+      "Cell vertices as an (n_cells, n_vertices) array, for meshes with a single cell type.");
+  topology.def(
+      "conn_csr",
+      [](const mesh::Topology &self) {
+        auto conn = self.conn();
+        std::vector<std::size_t> offsets(conn.size() + 1, 0);
+        for (std::size_t i = 0; i < conn.size(); i++) offsets[i + 1] = offsets[i] + conn[i].size();
+        std::vector<std::size_t> indices;
+        indices.reserve(offsets.back());
+        for (const auto &cell : conn) indices.insert(indices.end(), cell.begin(), cell.end());
+        const auto n_offsets = static_cast<py::ssize_t>(offsets.size());
+        const auto n_indices = static_cast<py::ssize_t>(indices.size());
+        return py::make_tuple(adopt(std::move(offsets), {n_offsets}),
+                              adopt(std::move(indices), {n_indices}));
+      },
+      "Cell vertices as (offsets, indices) arrays: cell i is indices[offsets[i]:offsets[i + 1]].");
+
+  py::class_<mesh::Mesh> mesh_type(m, "Mesh");
+  mesh_type.def("topology", py::overload_cast<>(&mesh::Mesh::topology),
+                py::return_value_policy::reference_internal);
+  mesh_type.def("geometry", py::overload_cast<>(&mesh::Mesh::geometry),
+                py::return_value_policy::reference_internal);
 }
 
 }  // namespace oiseau::wrappers
@@ -0,0 +1,42 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace oiseau::wrappers {
+
+namespace py = pybind11;
+
+/// NumPy array aliasing `data`, which stays valid as long as the Python object `owner` lives.
+template <class T>
+py::array_t<T> view(std::span<T> data, std::vector<py::ssize_t> shape, py::handle owner) {
+  return py::array_t<T>(std::move(shape), data.data(), owner);
+}
+
+/// Read-only NumPy array aliasing `data`, kept valid by `owner`.
+template <class T>
+py::array_t<T> view(std::span<const T> data, std::vector<py::ssize_t> shape, py::handle owner) {
+  py::array_t<T> array(std::move(shape), data.data(), owner);
+  array.attr("setflags")(py::arg("write") = false);
+  return array;
+}
+
+/// NumPy array taking over `data` without copying it; a capsule frees it with the array.
+template <class T>
+py::array_t<T> adopt(std::vector<T> &&data, std::vector<py::ssize_t> shape) {
+  auto *holder = new std::vector<T>(std::move(data));
+  py::capsule owner(holder, [](void *p) { delete static_cast<std::vector<T> *>(p); });
+  return py::array_t<T>(std::move(shape), holder->data(), owner);
+}
+
+}  // namespace oiseau::wrappers
@@ -3,3 +3,38 @@
 # This file is part of oiseau (https://github.com/tiagovla/oiseau)
 #
 # SPDX-License-Identifier: GPL-3.0-or-later
+
+import pathlib
+
+import numpy as np
+
+import oiseau.cpp as cpp
+
+MESH = pathlib.Path(__file__).parents[2] / "demo" / "meshes" / "mesh.msh"
+
+
+def test_geometry_x_aliases_mesh_memory():
+    mesh = cpp.io.gmsh_read_from_path(MESH)
+    x = mesh.geometry().x()
+    assert x.shape == (mesh.geometry().n_nodes(), mesh.geometry().dim())
+    x[0, 0] = 42.0
+    assert mesh.geometry().x()[0, 0] == 42.0
+
+
+def test_conn_and_csr_agree():
+    topology = cpp.io.gmsh_read_from_path(MESH).topology()
+    conn = topology.conn()
+    offsets, indices = topology.conn_csr()
+    assert conn.shape[0] == topology.n_cells() == offsets.size - 1
+    np.testing.assert_array_equal(conn.ravel(), indices)
+
+
+def test_dg_space_views_outlive_the_mesh_handle():
+    mesh = cpp.io.gmsh_read_from_path(MESH)
+    space = cpp.dg.DGSpace(mesh, [2] * mesh.topology().n_cells())
+    del mesh
+    offsets = space.offsets()
+    assert offsets[-1] == space.n_dofs()
+    assert not offsets.flags.writeable
+    nodes = space.element_nodes(0)
+    assert nodes.shape[0] == offsets[1]
@@ -6,66 +6,218 @@
 
 #include "oiseau/dg/dg_space.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <map>
+#include <mutex>
 #include <span>
 #include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 #include <xtensor-blas/xlinalg.hpp>
-#include <xtensor/containers/xadapt.hpp>
-#include <xtensor/containers/xbuffer_adaptor.hpp>
-#include <xtensor/io/xio.hpp>
-#include <xtensor/views/xslice.hpp>
-#include <xtensor/views/xview.hpp>
+#include <xtensor/containers/xarray.hpp>
 
 #include "oiseau/dg/nodal/element.hpp"
 #include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/dg/nodal/transfer.hpp"
+#include "oiseau/mesh/adapt.hpp"
 #include "oiseau/mesh/cell.hpp"
 #include "oiseau/mesh/mesh.hpp"
+#include "oiseau/utils/cache.hpp"
 
 namespace oiseau::dg {
 
+namespace {
+
+// maps the vertices of a cell to the nodes of its element of the given order: V_n(r) V_1^-1
+const xt::xarray<double>& vertex_interpolation(nodal::RefElementType type, unsigned order) {
+  using Key = std::pair<nodal::RefElementType, unsigned>;
+  static std::map<Key, xt::xarray<double>> cache;
+  static std::mutex mutex;
+
+  return oiseau::utils::cached(cache, mutex, Key{type, order}, [&] {
+    auto interp_elem = nodal::get_ref_element(type, 1);
+    auto v = interp_elem->vandermonde(nodal::get_ref_element(type, order)->r());
+    xt::xarray<double> map = xt::linalg::dot(v, xt::linalg::inv(interp_elem->v()));
+    if (type == nodal::RefElementType::Quadrilateral) {
+      // mesh quadrilaterals list their vertices counter-clockwise, while the order-1 reference
+      // nodes are in tensor order (-1, -1), (1, -1), (-1, 1), (1, 1)
+      for (std::size_t i = 0; i < map.shape()[0]; ++i) std::swap(map(i, 2), map(i, 3));
+    }
+    return map;
+  });
+}
+
+}  // namespace
+
 DGSpace::DGSpace(const mesh::Mesh& mesh, const std::vector<unsigned>& orders)
-    : m_mesh(mesh), m_orders(orders) {
+    : m_mesh(&mesh), m_orders(orders) {
   m_elements.reserve(orders.size());
+  for (std::size_t i = 0; i < orders.size(); ++i) m_elements.push_back(make_element(i, orders[i]));
+  compute_offsets();
+  // TODO(tiagovla): clean up this mess, introduce proper api
+}
+
+nodal::Element DGSpace::make_element(std::size_t cell, unsigned order) const {
+  const auto& topology = m_mesh->topology();
+  const auto& geometry = m_mesh->geometry();
+
+  mesh::CellKind kind = topology.cell_types()[cell]->kind();
+  nodal::RefElementType ref_type;
+  switch (kind) {
+  case mesh::CellKind::Triangle:
+    ref_type = nodal::RefElementType::Triangle;
+    break;
+  case mesh::CellKind::Quadrilateral:
+    ref_type = nodal::RefElementType::Quadrilateral;
+    break;
+  default:
+    throw std::runtime_error("Unsupported cell type");
+  }
+
+  const auto& interp = vertex_interpolation(ref_type, order);
+  const auto& vertices = topology.conn()[cell];
+  const std::size_t gdim = geometry.dim();
+  const std::size_t nv = vertices.size();
+  const std::size_t np = interp.shape()[0];
+  if (nv != interp.shape()[1]) {
+    throw std::invalid_argument("Cell " + std::to_string(cell) + " has " + std::to_string(nv) +
+                                " nodes, expected " + std::to_string(interp.shape()[1]));
+  }
+  const auto x = geometry.x();
+
+  auto nodes = xt::xarray<double>::from_shape({np, gdim});
+  for (std::size_t i = 0; i < np; ++i) {
+    for (std::size_t k = 0; k < gdim; ++k) {
+      double sum = 0.0;
+      for (std::size_t v = 0; v < nv; ++v) sum += interp(i, v) * x[vertices[v] * gdim + k];
+      nodes(i, k) = sum;
+    }
+  }
+  return nodal::Element(nodal::get_ref_element(ref_type, order), std::move(nodes));
+}
+
+void DGSpace::update(const mesh::AdaptChange& change) {
+  const std::size_t n_cells = change.origin.size();
+  if (m_mesh->topology().n_cells() != n_cells) {
+    throw std::invalid_argument("Adaptation does not match the number of mesh cells");
+  }
+  std::vector<unsigned> orders(n_cells);
+  std::vector<nodal::Element> elements;
+  elements.reserve(n_cells);
+  for (std::size_t i = 0; i < n_cells; ++i) {
+    const auto& sources = change.sources[i];
+    if (change.origin[i] == mesh::CellOrigin::Kept) {
+      orders[i] = m_orders[sources.front()];
+      elements.push_back(std::move(m_elements[sources.front()]));
+      continue;
+    }
+    // children keep the order of their parent; a merged cell takes the highest of its children
+    for (auto c : sources) orders[i] = std::max(orders[i], m_orders[c]);
+    elements.push_back(make_element(i, orders[i]));
+  }
+  m_orders = std::move(orders);
+  m_elements = std::move(elements);
+  compute_offsets();
+}
+
+void DGSpace::set_orders(std::span<const std::size_t> cells, std::span<const unsigned> orders) {
+  if (cells.size() != orders.size()) {
+    throw std::invalid_argument("cells and orders must have the same size");
+  }
+  // the last order given for a cell wins
+  std::map<std::size_t, unsigned> targets;
+  for (std::size_t k = 0; k < cells.size(); ++k) {
+    if (cells[k] >= m_elements.size()) throw std::out_of_range("Cell index out of range");
+    if (orders[k] == 0) throw std::invalid_argument("Order must be greater than 0");
+    targets[cells[k]] = orders[k];
+  }
 
-  auto topology = mesh.topology();
-  auto geometry = mesh.geometry();
-  auto cell_types = topology.cell_types();
-
-  std::array<std::size_t, 2> shape = {geometry.x().size() / geometry.dim(), geometry.dim()};
-  auto nodes = xt::adapt(geometry.x().data(), geometry.x().size(), xt::no_ownership(), shape);
-
-  for (std::size_t i = 0; i < cell_types.size(); ++i) {
-    const auto& cell_type = cell_types[i];
-    mesh::CellKind kind = cell_type->kind();
-
-    nodal::RefElementType ref_type;
-    switch (kind) {
-    case mesh::CellKind::Triangle:
-      ref_type = nodal::RefElementType::Triangle;
-      break;
-    case mesh::CellKind::Quadrilateral:
-      ref_type = nodal::RefElementType::Quadrilateral;
-      // FIX: wrong quadrilateral ordering
-      break;
-    default:
-      throw std::runtime_error("Unsupported cell type");
+  // every element is built before any is replaced, so a failure leaves the space untouched
+  std::vector<std::pair<std::size_t, nodal::Element>> rebuilt;
+  for (const auto& [cell, order] : targets) {
+    if (m_orders[cell] != order) rebuilt.emplace_back(cell, make_element(cell, order));
+  }
+  for (auto& [cell, element] : rebuilt) {
+    m_elements[cell] = std::move(element);
+    m_orders[cell] = targets[cell];
+  }
+  compute_offsets();
+}
+
+std::vector<double> DGSpace::set_orders(std::span<const std::size_t> cells,
+                                        std::span<const unsigned> orders,
+                                        std::span<const double> u) {
+  if (u.size() != n_dofs()) throw std::invalid_argument("Field size does not match the space");
+  std::vector<std::size_t> old_offsets = m_offsets;
+  std::vector<unsigned> old_orders = m_orders;
+  set_orders(cells, orders);
+
+  std::vector<double> v(n_dofs());
+  for (std::size_t i = 0; i < m_elements.size(); ++i) {
+    const auto u_i = u.subspan(old_offsets[i], old_offsets[i + 1] - old_offsets[i]);
+    const auto v_i = std::span(v).subspan(m_offsets[i], m_offsets[i + 1] - m_offsets[i]);
+    if (old_orders[i] == m_orders[i]) {
+      std::ranges::copy(u_i, v_i.begin());
+    } else {
+      const auto type = m_elements[i].reference().type();
+      nodal::apply_blocks(nodal::transfer_matrix(type, old_orders[i], m_orders[i]), u_i, v_i);
     }
+  }
+  return v;
+}
 
-    auto interp_elem = nodal::get_ref_element(ref_type, 1);
-    auto ref_elem = nodal::get_ref_element(ref_type, orders[i]);
-    auto x_view = xt::view(nodes, xt::keep(topology.conn()[i]), xt::all());
+std::vector<double> DGSpace::transfer(std::span<const double> u, const DGSpace& target,
+                                      nodal::TransferKind kind) const {
+  const std::size_t n_cells = m_elements.size();
+  if (target.m_elements.size() != n_cells) {
+    throw std::invalid_argument("Target space has a different number of elements");
+  }
+  if (u.size() != n_dofs()) throw std::invalid_argument("Field size does not match the space");
 
-    auto inv_v = xt::linalg::inv(interp_elem->v());
-    auto v = interp_elem->vandermonde(ref_elem->r());
-    auto interp_x = xt::linalg::dot(xt::linalg::dot(v, inv_v), x_view);
+  // elements sharing a (type, from, to) operator go through one matrix product
+  using Key = std::tuple<nodal::RefElementType, unsigned, unsigned>;
+  std::map<Key, std::vector<std::size_t>> groups;
+  for (std::size_t i = 0; i < n_cells; ++i) {
+    const auto type = m_elements[i].reference().type();
+    if (target.m_elements[i].reference().type() != type) {
+      throw std::invalid_argument("Target space has a different element type");
+    }
+    groups[{type, m_orders[i], target.m_orders[i]}].push_back(i);
+  }
+
+  std::vector<double> v(target.n_dofs());
+  std::vector<double> u_group, v_group;
+  for (const auto& [key, cells] : groups) {
+    const auto& [type, from, to] = key;
+    const auto& op = nodal::transfer_matrix(type, from, to, kind);
+    const std::size_t n_from = op.shape()[1];
+    const std::size_t n_to = op.shape()[0];
+    u_group.resize(cells.size() * n_from);
+    v_group.resize(cells.size() * n_to);
+    for (std::size_t k = 0; k < cells.size(); ++k) {
+      std::copy_n(u.begin() + m_offsets[cells[k]], n_from, u_group.begin() + k * n_from);
+    }
+    nodal::apply_blocks(op, u_group, v_group);
+    for (std::size_t k = 0; k < cells.size(); ++k) {
+      std::copy_n(v_group.begin() + k * n_to, n_to, v.begin() + target.m_offsets[cells[k]]);
+    }
+  }
+  return v;
+}
 
-    m_elements.emplace_back(ref_elem, interp_x);
+void DGSpace::compute_offsets() {
+  m_offsets.assign(m_elements.size() + 1, 0);
+  for (std::size_t i = 0; i < m_elements.size(); ++i) {
+    m_offsets[i + 1] = m_offsets[i] + m_elements[i].reference().number_of_nodes();
   }
-  // TODO(tiagovla): clean up this mess, introduce proper api
 }
+
 std::span<const nodal::Element> DGSpace::elements() const { return {m_elements}; }
 std::span<const unsigned> DGSpace::orders() const { return {m_orders}; }
+std::span<const std::size_t> DGSpace::offsets() const { return {m_offsets}; }
 
 }  // namespace oiseau::dg
@@ -6,11 +6,14 @@
 
 #pragma once
 
+#include <cstddef>
 #include <iostream>
 #include <span>
 #include <vector>
 
 #include "oiseau/dg/nodal/element.hpp"
+#include "oiseau/dg/nodal/transfer.hpp"
+#include "oiseau/mesh/adapt.hpp"
 #include "oiseau/mesh/mesh.hpp"
 
 namespace oiseau::dg {
@@ -22,16 +25,57 @@ class DGSpace {
   DGSpace(DGSpace&& V) = default;
   virtual ~DGSpace() = default;
   DGSpace& operator=(const DGSpace& V) = delete;
-  DGSpace& operator=(DGSpace&& V) = delete;
+  DGSpace& operator=(DGSpace&& V) = default;
 
-  inline const mesh::Mesh& mesh() const { return m_mesh; };
+  inline const mesh::Mesh& mesh() const { return *m_mesh; };
   std::span<const nodal::Element> elements() const;
   std::span<const unsigned> orders() const;
 
+  /**
+   * @brief First degree of freedom of each element, followed by the total count.
+   *
+   * A nodal field stores the values of element i in `[offsets()[i], offsets()[i + 1])`.
+   */
+  std::span<const std::size_t> offsets() const;
+  inline std::size_t n_dofs() const { return m_offsets.back(); }
+
+  /**
+   * @brief Sets the order of `cells[k]` to `orders[k]`, rebuilding only those elements.
+   *
+   * Reference elements come from the shared cache. The overload taking a field returns it in
+   * the new layout: values of unchanged elements are copied and the others are projected with
+   * `nodal::transfer_matrix`. Indices and orders are checked before anything changes, so a
+   * throwing call leaves the space as it was.
+   */
+  void set_orders(std::span<const std::size_t> cells, std::span<const unsigned> orders);
+  std::vector<double> set_orders(std::span<const std::size_t> cells,
+                                 std::span<const unsigned> orders, std::span<const double> u);
+
+  /**
+   * @brief Carries a nodal field to `target`, a space on the same mesh with other orders.
+   *
+   * Elements are grouped by cell type and order pair, and each group is transferred with one
+   * matrix product, e.g. between the levels of a p-multigrid hierarchy.
+   */
+  std::vector<double> transfer(std::span<const double> u, const DGSpace& target,
+                               nodal::TransferKind kind = nodal::TransferKind::Projection) const;
+
+  /**
+   * @brief Follows an `AdaptiveMesh` change of the mesh this space is built on.
+   *
+   * Elements of kept cells are reused, refined cells pass their order to their children and
+   * coarsened cells take the highest order of the children they replace.
+   */
+  void update(const mesh::AdaptChange& change);
+
  private:
-  const mesh::Mesh& m_mesh;
+  nodal::Element make_element(std::size_t cell, unsigned order) const;
+  void compute_offsets();
+
+  const mesh::Mesh* m_mesh;
   std::vector<nodal::Element> m_elements;
-  const std::vector<unsigned> m_orders;
+  std::vector<unsigned> m_orders;
+  std::vector<std::size_t> m_offsets;
 };
 
 }  // namespace oiseau::dg
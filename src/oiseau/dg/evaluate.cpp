@@ -0,0 +1,97 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/dg/evaluate.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/containers/xarray.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+
+#include "oiseau/dg/dg_space.hpp"
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/mesh/locate.hpp"
+
+namespace oiseau::dg {
+
+PointEvaluator::PointEvaluator(const DGSpace& space,
+                               std::span<const mesh::PointLocation> locations)
+    : m_n_points(locations.size()), m_n_dofs(space.n_dofs()) {
+  const auto elements = space.elements();
+  const auto offsets = space.offsets();
+
+  // points in cells of the same type and order share one vandermonde product
+  using Key = std::pair<nodal::RefElementType, unsigned>;
+  std::map<Key, std::vector<std::size_t>> groups;
+  for (std::size_t p = 0; p < locations.size(); ++p) {
+    const std::size_t cell = locations[p].cell;
+    if (cell == mesh::NOT_FOUND) continue;
+    if (cell >= elements.size()) throw std::out_of_range("Point located in an unknown cell");
+    const auto& ref = elements[cell].reference();
+    groups[{ref.type(), ref.order()}].push_back(p);
+  }
+
+  for (auto& [key, points] : groups) {
+    std::ranges::stable_sort(points, {}, [&](std::size_t p) { return locations[p].cell; });
+    const auto& [type, order] = key;
+    const auto ref = nodal::get_ref_element(type, order);
+    const std::size_t np = ref->number_of_nodes();
+    const std::size_t dim = ref->r().dimension() == 1 ? 1 : ref->r().shape()[1];
+
+    xt::xarray<double> r;
+    if (dim == 1) {
+      r = xt::zeros<double>(std::vector<std::size_t>{points.size()});
+      for (std::size_t k = 0; k < points.size(); ++k) r(k) = locations[points[k]].ref[0];
+    } else {
+      r = xt::zeros<double>(std::vector<std::size_t>{points.size(), dim});
+      for (std::size_t k = 0; k < points.size(); ++k) {
+        for (std::size_t d = 0; d < dim; ++d) r(k, d) = locations[points[k]].ref[d];
+      }
+    }
+    xt::xarray<double> rows = xt::linalg::dot(ref->vandermonde(r), xt::linalg::inv(ref->v()));
+
+    for (std::size_t k = 0; k < points.size(); ++k) {
+      m_points.push_back(points[k]);
+      m_dof_offsets.push_back(offsets[locations[points[k]].cell]);
+      m_row_offsets.push_back(m_weights.size());
+      for (std::size_t j = 0; j < np; ++j) m_weights.push_back(rows(k, j));
+    }
+  }
+  m_row_offsets.push_back(m_weights.size());
+}
+
+void PointEvaluator::evaluate(std::span<const double> u, std::span<double> values) const {
+  if (u.size() != m_n_dofs) throw std::invalid_argument("Field size does not match the space");
+  if (values.size() != m_n_points) {
+    throw std::invalid_argument("Output size does not match the number of points");
+  }
+  std::ranges::fill(values, std::numeric_limits<double>::quiet_NaN());
+  const std::size_t n_located = m_points.size();
+#pragma omp parallel for
+  for (std::size_t k = 0; k < n_located; ++k) {
+    const double* w = m_weights.data() + m_row_offsets[k];
+    const double* u_k = u.data() + m_dof_offsets[k];
+    const std::size_t np = m_row_offsets[k + 1] - m_row_offsets[k];
+    double sum = 0.0;
+    for (std::size_t j = 0; j < np; ++j) sum += w[j] * u_k[j];
+    values[m_points[k]] = sum;
+  }
+}
+
+std::vector<double> PointEvaluator::evaluate(std::span<const double> u) const {
+  std::vector<double> values(m_n_points);
+  evaluate(u, values);
+  return values;
+}
+
+}  // namespace oiseau::dg
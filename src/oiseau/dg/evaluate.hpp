@@ -0,0 +1,54 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "oiseau/dg/dg_space.hpp"
+#include "oiseau/mesh/locate.hpp"
+
+namespace oiseau::dg {
+
+/**
+ * @brief Cached plan evaluating nodal fields of a `DGSpace` at fixed located points.
+ *
+ * Points are grouped by the cell type and order of the element holding them, and each group
+ * gets its interpolation rows `vandermonde(r) inv(v)` in one product. Applying the plan is then
+ * a gather of the cell values and one dot product per point, so repeated probes of a field
+ * over many time steps never touch the reference elements again.
+ *
+ * The plan holds dof offsets of `space`, and must be rebuilt when its orders or mesh change.
+ */
+class PointEvaluator {
+ public:
+  /**
+   * @param space space the fields live in
+   * @param locations cells and reference coordinates of the points, e.g. from
+   * `mesh::PointLocator::locate`; points with no cell evaluate to NaN
+   */
+  PointEvaluator(const DGSpace& space, std::span<const mesh::PointLocation> locations);
+
+  inline std::size_t n_points() const { return m_n_points; }
+
+  /// Writes the values of the nodal field `u` at the points into `values`.
+  void evaluate(std::span<const double> u, std::span<double> values) const;
+  std::vector<double> evaluate(std::span<const double> u) const;
+
+ private:
+  std::size_t m_n_points;
+  std::size_t m_n_dofs;
+  // for each located point, in cell-grouped order: its index, the first dof of its cell and
+  // the start of its row in `m_weights`
+  std::vector<std::size_t> m_points;
+  std::vector<std::size_t> m_dof_offsets;
+  std::vector<std::size_t> m_row_offsets;
+  std::vector<double> m_weights;
+};
+
+}  // namespace oiseau::dg
@@ -0,0 +1,190 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/dg/local_time_stepping.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "oiseau/dg/nodal/element.hpp"
+#include "oiseau/dg/time_integration.hpp"
+
+namespace oiseau::dg {
+
+double stable_time_step(const nodal::Element &element, double cfl, double wave_speed) {
+  const auto &x = element.nodes();
+  const std::size_t np = x.shape()[0];
+  const std::size_t gdim = x.shape()[1];
+  double d_min = std::numeric_limits<double>::max();
+  for (std::size_t i = 0; i < np; i++) {
+    for (std::size_t j = i + 1; j < np; j++) {
+      double d2 = 0.0;
+      for (std::size_t k = 0; k < gdim; k++) d2 += (x(i, k) - x(j, k)) * (x(i, k) - x(j, k));
+      d_min = std::min(d_min, std::sqrt(d2));
+    }
+  }
+  return cfl * d_min / wave_speed;
+}
+
+TimeLevels assign_time_levels(std::span<const double> stable_dt, unsigned max_levels) {
+  if (stable_dt.empty()) throw std::invalid_argument("No cells to assign time levels to");
+  if (max_levels == 0) throw std::invalid_argument("At least one time level is needed");
+  const auto [dt_min, dt_max] = std::ranges::minmax(stable_dt);
+  if (!(dt_min > 0.0)) throw std::invalid_argument("Stable time steps must be positive");
+
+  // the finest level steps with dt_min; the coarsest with dt_min * 2^(n - 1)
+  const unsigned n_levels =
+      std::min<unsigned>(max_levels, static_cast<unsigned>(std::log2(dt_max / dt_min)) + 1);
+  TimeLevels levels;
+  levels.dt = dt_min * std::ldexp(1.0, static_cast<int>(n_levels) - 1);
+  levels.level.resize(stable_dt.size());
+  levels.level_offsets.assign(n_levels + 1, 0);
+  for (std::size_t i = 0; i < stable_dt.size(); i++) {
+    const auto k = static_cast<unsigned>(std::log2(stable_dt[i] / dt_min));
+    levels.level[i] = n_levels - 1 - std::min(k, n_levels - 1);
+    levels.level_offsets[levels.level[i] + 1]++;
+  }
+  for (unsigned l = 0; l < n_levels; l++) levels.level_offsets[l + 1] += levels.level_offsets[l];
+
+  levels.new_to_old.resize(stable_dt.size());
+  std::vector<std::size_t> next(levels.level_offsets.begin(), levels.level_offsets.end() - 1);
+  for (std::size_t i = 0; i < stable_dt.size(); i++) levels.new_to_old[next[levels.level[i]]++] = i;
+  return levels;
+}
+
+LocalTimeStepper::LocalTimeStepper(RKScheme scheme, std::span<const unsigned> cell_levels,
+                                   double dt, std::span<const std::vector<std::size_t>> e_to_e,
+                                   std::span<const std::size_t> cell_offsets)
+    : m_scheme(scheme),
+      m_dt(dt),
+      m_levels(cell_levels.begin(), cell_levels.end()),
+      m_cell_offsets(cell_offsets.begin(), cell_offsets.end()) {
+  const std::size_t n_cells = cell_levels.size();
+  if (e_to_e.size() != n_cells || cell_offsets.size() != n_cells + 1) {
+    throw std::invalid_argument("Connectivity and offsets must match the number of cells");
+  }
+  if (!std::ranges::is_sorted(cell_levels)) {
+    throw std::invalid_argument("Cells must be numbered level after level");
+  }
+
+  const unsigned n_levels = n_cells == 0 ? 1 : cell_levels.back() + 1;
+  m_level_offsets.assign(n_levels + 1, 0);
+  for (auto l : cell_levels) m_level_offsets[l + 1]++;
+  for (unsigned l = 0; l < n_levels; l++) m_level_offsets[l + 1] += m_level_offsets[l];
+
+  m_level_cells.resize(n_levels);
+  m_coupled_cells.resize(n_levels);
+  m_interface_cells.resize(n_levels);
+  for (std::size_t c = 0; c < n_cells; c++) {
+    m_level_cells[m_levels[c]].push_back(c);
+    // c takes the faces to each finer level it touches from that level's stages
+    std::vector<unsigned> finer;
+    for (auto k : e_to_e[c]) {
+      if (m_levels[k] > m_levels[c]) finer.push_back(m_levels[k]);
+    }
+    std::ranges::sort(finer);
+    auto [first, last] = std::ranges::unique(finer);
+    finer.erase(first, last);
+    for (auto l : finer) m_interface_cells[l].push_back(c);
+    if (!finer.empty()) m_coupled_cells[m_levels[c]].push_back(c);
+  }
+
+  m_dudt.resize(m_cell_offsets.back());
+  m_register.resize(m_cell_offsets.back());
+  m_flux.resize(m_cell_offsets.back());
+  m_accumulated.assign(m_cell_offsets.back(), 0.0);
+  m_start.resize(m_cell_offsets.back());
+  m_end.resize(m_cell_offsets.back());
+  m_start_time.resize(n_levels);
+  m_level_dt.resize(n_levels);
+}
+
+void LocalTimeStepper::step(const PartialRHSFunction &rhs, double t, std::span<double> u) {
+  if (u.size() != m_cell_offsets.back()) {
+    throw std::invalid_argument("Field size does not match the stepper");
+  }
+  advance(rhs, 0, t, m_dt, u);
+}
+
+void LocalTimeStepper::advance(const PartialRHSFunction &rhs, unsigned level, double t,
+                               double dt, std::span<double> u) {
+  const auto &k = detail::rk_coefficients(m_scheme);
+  const std::size_t first = m_cell_offsets[m_level_offsets[level]];
+  const std::size_t last = m_cell_offsets[m_level_offsets[level + 1]];
+  const auto top = static_cast<unsigned>(n_levels() - 1);
+  const FaceSelection all = {true, m_levels, 0, top};
+  const FaceSelection finer = {false, m_levels, level + 1, top};
+  const FaceSelection interface = {false, m_levels, level, level};
+  const auto &cells = m_level_cells[level];
+  const auto &coupled = m_coupled_cells[level];
+  const auto &interface_cells = m_interface_cells[level];
+
+  auto accumulate = [&](std::span<const std::size_t> targets, double weight) {
+    for (auto c : targets) {
+      for (std::size_t i = m_cell_offsets[c]; i < m_cell_offsets[c + 1]; i++) {
+        m_accumulated[i] += weight * m_flux[i];
+      }
+    }
+  };
+
+  m_start_time[level] = t;
+  m_level_dt[level] = dt;
+  for (auto c : coupled) {
+    std::copy(u.begin() + m_cell_offsets[c], u.begin() + m_cell_offsets[c + 1],
+              m_start.begin() + m_cell_offsets[c]);
+  }
+
+  // finer levels are still at t; the faces to them are corrected once they have caught up
+  for (std::size_t s = 0; s < k.a.size(); s++) {
+    const double ts = t + k.c[s] * dt;
+    interpolate(ts, u, interface_cells);
+    rhs(ts, u, m_dudt, cells, all);
+    if (!coupled.empty()) {
+      rhs(ts, u, m_flux, coupled, finer);
+      accumulate(coupled, -dt * k.weight[s]);
+    }
+    if (!interface_cells.empty()) {
+      rhs(ts, u, m_flux, interface_cells, interface);
+      accumulate(interface_cells, dt * k.weight[s]);
+    }
+    detail::rk_stage(m_scheme, s, dt, last - first, u.data() + first, m_register.data() + first,
+                     m_dudt.data() + first);
+  }
+
+  if (level + 1 == n_levels()) return;
+  for (auto c : coupled) {
+    std::copy(u.begin() + m_cell_offsets[c], u.begin() + m_cell_offsets[c + 1],
+              m_end.begin() + m_cell_offsets[c]);
+  }
+  advance(rhs, level + 1, t, 0.5 * dt, u);
+  advance(rhs, level + 1, t + 0.5 * dt, 0.5 * dt, u);
+
+  // swap the fluxes taken against the states at t for those integrated by the finer levels
+  for (auto c : coupled) {
+    for (std::size_t i = m_cell_offsets[c]; i < m_cell_offsets[c + 1]; i++) {
+      u[i] = m_end[i] + m_accumulated[i];
+      m_accumulated[i] = 0.0;
+    }
+  }
+}
+
+void LocalTimeStepper::interpolate(double t, std::span<double> u,
+                                   std::span<const std::size_t> cells) const {
+  for (auto c : cells) {
+    const unsigned l = m_levels[c];
+    const double theta = (t - m_start_time[l]) / m_level_dt[l];
+    for (std::size_t i = m_cell_offsets[c]; i < m_cell_offsets[c + 1]; i++) {
+      u[i] = m_start[i] + theta * (m_end[i] - m_start[i]);
+    }
+  }
+}
+
+}  // namespace oiseau::dg
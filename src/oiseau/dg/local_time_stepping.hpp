@@ -0,0 +1,119 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "oiseau/dg/nodal/element.hpp"
+#include "oiseau/dg/time_integration.hpp"
+
+namespace oiseau::dg {
+
+/**
+ * @brief Largest stable explicit step of an element: `cfl * d_min / wave_speed`.
+ *
+ * d_min is the smallest distance between two nodes of the element, which already shrinks
+ * like h / N^2 with the order N.
+ */
+double stable_time_step(const nodal::Element &element, double cfl, double wave_speed = 1.0);
+
+/**
+ * @brief Cells grouped into power-of-two time step levels.
+ *
+ * Level l steps with `dt / 2^l`, so level 0 holds the largest cells. `new_to_old` lists the
+ * cells level after level, keeping their relative order, with level l in
+ * `[level_offsets[l], level_offsets[l + 1])`; applying it to the mesh (e.g. with
+ * `Topology::permute_cells`) makes each level contiguous in memory.
+ */
+struct TimeLevels {
+  double dt;
+  std::vector<unsigned> level;
+  std::vector<std::size_t> new_to_old;
+  std::vector<std::size_t> level_offsets;
+
+  std::size_t n_levels() const { return level_offsets.size() - 1; }
+};
+
+/// Levels from the stable step of each cell, using at most `max_levels` levels.
+TimeLevels assign_time_levels(std::span<const double> stable_dt, unsigned max_levels);
+
+/**
+ * @brief Which parts of the right-hand side of a cell to evaluate.
+ *
+ * The volume term is wanted when `volume` is set, and the face shared with neighbour nb when
+ * `includes(nb)`; boundary faces count as faces to the cell itself.
+ */
+struct FaceSelection {
+  bool volume;
+  std::span<const unsigned> levels;
+  unsigned min_level;
+  unsigned max_level;
+
+  bool includes(std::size_t neighbour) const {
+    return levels[neighbour] >= min_level && levels[neighbour] <= max_level;
+  }
+};
+
+/// Writes the selected contributions to du/dt of `cells` into their entries of `dudt`.
+using PartialRHSFunction =
+    std::function<void(double t, std::span<const double> u, std::span<double> dudt,
+                       std::span<const std::size_t> cells, const FaceSelection &faces)>;
+
+/**
+ * @brief Multi-rate explicit stepper advancing each time level at its own rate.
+ *
+ * Cells must be numbered level after level, as after applying `TimeLevels::new_to_old`. A step
+ * of level l advances its cells with the full right-hand side, with finer neighbours held at
+ * the start of the step, then runs two steps of level l + 1 (Berger & Colella subcycling).
+ * Faces between two levels are integrated by the finer one, which sees the coarser cells
+ * linearly interpolated in time. Coarser interface cells evaluate the same faces at every
+ * finer stage and accumulate them with the stage weights, minus what their own stages used;
+ * adding the difference afterwards (refluxing) gives both sides identical interface fluxes,
+ * so the scheme stays conservative and second order in time across levels.
+ */
+class LocalTimeStepper {
+ public:
+  LocalTimeStepper(RKScheme scheme, std::span<const unsigned> cell_levels, double dt,
+                   std::span<const std::vector<std::size_t>> e_to_e,
+                   std::span<const std::size_t> cell_offsets);
+
+  double dt() const { return m_dt; }
+  std::size_t n_levels() const { return m_level_offsets.size() - 1; }
+
+  /// Advances every level from t to t + dt().
+  void step(const PartialRHSFunction &rhs, double t, std::span<double> u);
+
+ private:
+  void advance(const PartialRHSFunction &rhs, unsigned level, double t, double dt,
+               std::span<double> u);
+  void interpolate(double t, std::span<double> u, std::span<const std::size_t> cells) const;
+
+  RKScheme m_scheme;
+  double m_dt;
+  std::vector<unsigned> m_levels;
+  std::vector<std::size_t> m_level_offsets;
+  std::vector<std::size_t> m_cell_offsets;
+  std::vector<std::vector<std::size_t>> m_level_cells;
+  // cells of each level with a finer neighbour
+  std::vector<std::vector<std::size_t>> m_coupled_cells;
+  // cells of coarser levels with a neighbour in each level
+  std::vector<std::vector<std::size_t>> m_interface_cells;
+  std::vector<double> m_dudt;
+  std::vector<double> m_register;
+  std::vector<double> m_flux;
+  std::vector<double> m_accumulated;
+  // coupled cells before and after their level's current step, and when that step started
+  std::vector<double> m_start;
+  std::vector<double> m_end;
+  std::vector<double> m_start_time;
+  std::vector<double> m_level_dt;
+};
+
+}  // namespace oiseau::dg
@@ -0,0 +1,123 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/dg/nodal/dealiasing.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/containers/xarray.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+#include <xtensor/misc/xmanipulation.hpp>
+#include <xtensor/views/xview.hpp>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/dg/nodal/transfer.hpp"
+#include "oiseau/utils/cache.hpp"
+#include "oiseau/utils/integration.hpp"
+
+namespace oiseau::dg::nodal {
+
+namespace {
+
+void copy_rule(const utils::integration::CubatureRule &rule, CubatureOperators &ops) {
+  ops.points = rule.nodes_view();
+  ops.weights = rule.weights_view();
+}
+
+// tensor Gauss-Legendre rule on [-1, 1]^dim, r running fastest
+void tensor_rule(std::size_t dim, unsigned cubature_order, CubatureOperators &ops) {
+  auto [x, w] = utils::integration::jacobi_gq(cubature_order / 2, 0.0, 0.0);
+  const std::size_t n = x.size();
+  if (dim == 1) {
+    ops.points = x;
+    ops.weights = w;
+    return;
+  }
+  ops.points = xt::zeros<double>(std::vector<std::size_t>{n * n, 2});
+  ops.weights = xt::zeros<double>(std::vector<std::size_t>{n * n});
+  for (std::size_t j = 0; j < n; j++) {
+    for (std::size_t i = 0; i < n; i++) {
+      ops.points(j * n + i, 0) = x(i);
+      ops.points(j * n + i, 1) = x(j);
+      ops.weights(j * n + i) = w(i) * w(j);
+    }
+  }
+}
+
+CubatureOperators make_operators(RefElementType type, unsigned order, unsigned cubature_order) {
+  const int q = static_cast<int>(std::max(cubature_order, 1u));
+  CubatureOperators ops;
+  switch (type) {
+  case RefElementType::Line:
+    tensor_rule(1, q, ops);
+    break;
+  case RefElementType::Quadrilateral:
+    tensor_rule(2, q, ops);
+    break;
+  case RefElementType::Triangle:
+    copy_rule(utils::integration::cubature_rule(q), ops);
+    break;
+  case RefElementType::Tetrahedron:
+    copy_rule(utils::integration::tetrahedron_cubature_rule(q), ops);
+    break;
+  case RefElementType::Hexahedron:
+    copy_rule(utils::integration::hexahedron_cubature_rule(q), ops);
+    break;
+  default:
+    throw std::invalid_argument("Unknown element type");
+  }
+
+  auto ref = get_ref_element(type, order);
+  ops.interpolation = interpolation_matrix(*ref, ops.points);
+  // with an orthonormal modal basis, M^-1 = V V^T
+  auto inv_mass = xt::linalg::dot(ref->v(), xt::transpose(ref->v()));
+  xt::xarray<double> weighted = xt::transpose(ops.interpolation) * ops.weights;
+  ops.projection = xt::linalg::dot(inv_mass, weighted);
+
+  const auto &d = ref->d();
+  const std::size_t dim = d.dimension() == 2 ? 1 : d.shape()[2];
+  for (std::size_t k = 0; k < dim; k++) {
+    xt::xarray<double> d_k = d;
+    if (d.dimension() == 3) d_k = xt::view(d, xt::all(), xt::all(), k);
+    xt::xarray<double> grad = xt::linalg::dot(ops.interpolation, d_k);
+    xt::xarray<double> weighted_grad = xt::transpose(grad) * ops.weights;
+    ops.weak_derivative.push_back(xt::linalg::dot(inv_mass, weighted_grad));
+  }
+  return ops;
+}
+
+}  // namespace
+
+const CubatureOperators &cubature_operators(RefElementType type, unsigned order,
+                                            unsigned cubature_order) {
+  using Key = std::tuple<RefElementType, unsigned, unsigned>;
+  static std::map<Key, CubatureOperators> cache;
+  static std::mutex mutex;
+  return oiseau::utils::cached(cache, mutex, Key{type, order, cubature_order},
+                               [&] { return make_operators(type, order, cubature_order); });
+}
+
+void project_pointwise(const CubatureOperators &ops, std::span<const double> u,
+                       std::span<double> v, const std::function<void(std::span<double>)> &f,
+                       std::vector<double> &work) {
+  const std::size_t np = ops.interpolation.shape()[1];
+  const std::size_t nc = ops.interpolation.shape()[0];
+  if (u.size() % np != 0) throw std::invalid_argument("Block sizes do not match the operator");
+  work.resize(u.size() / np * nc);
+  apply_blocks(ops.interpolation, u, work);
+  f(work);
+  apply_blocks(ops.projection, work, v);
+}
+
+}  // namespace oiseau::dg::nodal
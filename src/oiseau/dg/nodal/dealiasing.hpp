@@ -0,0 +1,55 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <span>
+#include <vector>
+#include <xtensor/containers/xarray.hpp>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+
+namespace oiseau::dg::nodal {
+
+/**
+ * @brief Operators between the nodes of a reference element and a cubature set on it.
+ *
+ * `interpolation` (nc x np) evaluates nodal values at the cubature `points`. `projection`
+ * (np x nc) is M^-1 I^T W, taking values at the points to the nodal values of their L2
+ * projection, and `weak_derivative[k]` (np x nc) is M^-1 (I D_k)^T W, taking a flux component
+ * along r_k to M^-1 (F_k, d l_i / d r_k). The inverse mass is fused in, so a dealiased volume
+ * term costs one product to the points and one back; on affine cells the |J| of the weights
+ * cancels the one of the mass.
+ */
+struct CubatureOperators {
+  xt::xarray<double> points;
+  xt::xarray<double> weights;
+  xt::xarray<double> interpolation;
+  xt::xarray<double> projection;
+  std::vector<xt::xarray<double>> weak_derivative;
+};
+
+/**
+ * @brief Operators on a rule exact to degree `cubature_order`, built once per key and cached.
+ *
+ * Products of k order-N polynomials against a test function need `cubature_order` (k + 1) N.
+ */
+const CubatureOperators &cubature_operators(RefElementType type, unsigned order,
+                                            unsigned cubature_order);
+
+/**
+ * @brief L2 projection of f(u) for elements stored block after block.
+ *
+ * u is interpolated to the cubature points of every element with one matrix product, `f`
+ * updates those values in place, and one more product projects them back into `v`. `work`
+ * holds the point values and is resized as needed, so it can be reused across calls.
+ */
+void project_pointwise(const CubatureOperators &ops, std::span<const double> u,
+                       std::span<double> v, const std::function<void(std::span<double>)> &f,
+                       std::vector<double> &work);
+
+}  // namespace oiseau::dg::nodal
@@ -0,0 +1,261 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/dg/nodal/operators.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/containers/xarray.hpp>
+#include <xtensor/core/xeval.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+#include <xtensor/misc/xmanipulation.hpp>
+#include <xtensor/views/xview.hpp>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/utils/cache.hpp"
+
+namespace oiseau::dg::nodal {
+
+namespace {
+
+constexpr double TOL = 1e-10;
+
+using Point = std::vector<double>;
+
+mesh::CellKind cell_kind(RefElementType type) {
+  switch (type) {
+  case RefElementType::Line:
+    return mesh::CellKind::Interval;
+  case RefElementType::Triangle:
+    return mesh::CellKind::Triangle;
+  case RefElementType::Quadrilateral:
+    return mesh::CellKind::Quadrilateral;
+  case RefElementType::Tetrahedron:
+    return mesh::CellKind::Tetrahedron;
+  case RefElementType::Hexahedron:
+    return mesh::CellKind::Hexahedron;
+  }
+  throw std::invalid_argument("Unknown element type");
+}
+
+// vertices of the reference cells, in the order of the mesh cells
+std::vector<Point> ref_vertices(RefElementType type) {
+  switch (type) {
+  case RefElementType::Line:
+    return {{-1.0}, {1.0}};
+  case RefElementType::Triangle:
+    return {{-1.0, -1.0}, {1.0, -1.0}, {-1.0, 1.0}};
+  case RefElementType::Quadrilateral:
+    return {{-1.0, -1.0}, {1.0, -1.0}, {1.0, 1.0}, {-1.0, 1.0}};
+  case RefElementType::Tetrahedron:
+    return {{-1.0, -1.0, -1.0}, {1.0, -1.0, -1.0}, {-1.0, 1.0, -1.0}, {-1.0, -1.0, 1.0}};
+  case RefElementType::Hexahedron:
+    return {{-1.0, -1.0, -1.0}, {1.0, -1.0, -1.0}, {1.0, 1.0, -1.0}, {-1.0, 1.0, -1.0},
+            {-1.0, -1.0, 1.0},  {1.0, -1.0, 1.0},  {1.0, 1.0, 1.0},  {-1.0, 1.0, 1.0}};
+  }
+  throw std::invalid_argument("Unknown element type");
+}
+
+// vertices 1..dim of the reference cell span its affine map from vertex 0
+std::vector<std::size_t> affine_vertices(RefElementType type) {
+  switch (type) {
+  case RefElementType::Line:
+    return {1};
+  case RefElementType::Triangle:
+    return {1, 2};
+  case RefElementType::Quadrilateral:
+    return {1, 3};
+  case RefElementType::Tetrahedron:
+    return {1, 2, 3};
+  case RefElementType::Hexahedron:
+    return {1, 3, 4};
+  }
+  throw std::invalid_argument("Unknown element type");
+}
+
+double dot(const Point &a, const Point &b) {
+  double sum = 0.0;
+  for (std::size_t k = 0; k < a.size(); k++) sum += a[k] * b[k];
+  return sum;
+}
+
+Point axpy(double alpha, const Point &x, const Point &y) {
+  Point out(y);
+  for (std::size_t k = 0; k < x.size(); k++) out[k] += alpha * x[k];
+  return out;
+}
+
+struct FaceNodes {
+  std::vector<std::size_t> nodes;
+  xt::xarray<double> coords;
+};
+
+// nodes of `ref` lying on the face spanned by `p`, with their coordinates on the reference
+// face: p[0] -> p[1] is the first face axis and p[0] -> p.back() the second one
+FaceNodes find_face_nodes(const RefElement &ref, const std::vector<Point> &p) {
+  const auto &r = ref.r();
+  const std::size_t dim = p.front().size();
+  const Point a = axpy(-1.0, p[0], p.size() > 1 ? p[1] : p[0]);
+  const Point b = axpy(-1.0, p[0], p.back());
+  const double aa = dot(a, a), ab = dot(a, b), bb = dot(b, b);
+
+  std::vector<std::pair<std::array<double, 2>, std::size_t>> found;
+  for (std::size_t i = 0; i < ref.number_of_nodes(); i++) {
+    Point d(dim);
+    for (std::size_t k = 0; k < dim; k++) d[k] = (r.dimension() == 1 ? r(i) : r(i, k)) - p[0][k];
+    double u = 0.0, w = 0.0;
+    if (p.size() == 2) {
+      u = dot(a, d) / aa;
+    } else if (p.size() > 2) {
+      const double det = aa * bb - ab * ab;
+      u = (bb * dot(a, d) - ab * dot(b, d)) / det;
+      w = (aa * dot(b, d) - ab * dot(a, d)) / det;
+    }
+    Point off = axpy(-w, b, axpy(-u, a, d));
+    if (std::sqrt(dot(off, off)) < TOL) found.push_back({{2.0 * u - 1.0, 2.0 * w - 1.0}, i});
+  }
+  if (found.size() != ref.number_of_face_nodes()) {
+    throw std::runtime_error("Unexpected number of nodes on a reference face");
+  }
+  std::ranges::sort(found, [](const auto &x, const auto &y) {
+    if (std::abs(x.first[1] - y.first[1]) > TOL) return x.first[1] < y.first[1];
+    return x.first[0] < y.first[0];
+  });
+
+  FaceNodes face;
+  const std::size_t nfp = found.size();
+  if (p.size() > 2) {
+    face.coords = xt::zeros<double>(std::vector<std::size_t>{nfp, 2});
+  } else {
+    face.coords = xt::zeros<double>(std::vector<std::size_t>{nfp});
+  }
+  for (std::size_t j = 0; j < nfp; j++) {
+    face.nodes.push_back(found[j].second);
+    if (p.size() > 2) {
+      face.coords(j, 0) = found[j].first[0];
+      face.coords(j, 1) = found[j].first[1];
+    } else {
+      face.coords(j) = found[j].first[0];
+    }
+  }
+  return face;
+}
+
+xt::xarray<double> face_mass_matrix(RefElementType type, unsigned order,
+                                    const xt::xarray<double> &coords) {
+  RefElementType face_type;
+  switch (type) {
+  case RefElementType::Line:
+    return xt::ones<double>(std::vector<std::size_t>{1, 1});
+  case RefElementType::Triangle:
+  case RefElementType::Quadrilateral:
+    face_type = RefElementType::Line;
+    break;
+  case RefElementType::Tetrahedron:
+    face_type = RefElementType::Triangle;
+    break;
+  case RefElementType::Hexahedron:
+    face_type = RefElementType::Quadrilateral;
+    break;
+  default:
+    throw std::invalid_argument("Unknown element type");
+  }
+  auto vf = get_ref_element(face_type, order)->vandermonde(coords);
+  return xt::linalg::inv(xt::linalg::dot(vf, xt::transpose(vf)));
+}
+
+RefOperators make_operators(RefElementType type, unsigned order) {
+  auto ref = get_ref_element(type, order);
+  const std::size_t np = ref->number_of_nodes();
+  const std::size_t nfp = ref->number_of_face_nodes();
+
+  RefOperators ops;
+  ops.inv_mass = xt::linalg::dot(ref->v(), xt::transpose(ref->v()));
+  ops.mass = xt::linalg::inv(ops.inv_mass);
+  ops.mass_cholesky = xt::linalg::cholesky(ops.mass);
+
+  const auto &d = ref->d();
+  if (d.dimension() == 2) {
+    ops.stiffness.push_back(xt::linalg::dot(ops.mass, d));
+  } else {
+    for (std::size_t i = 0; i < d.shape()[2]; i++) {
+      xt::xarray<double> d_i = xt::view(d, xt::all(), xt::all(), i);
+      ops.stiffness.push_back(xt::linalg::dot(ops.mass, d_i));
+    }
+  }
+
+  auto cell = mesh::get_cell_type(cell_kind(type));
+  auto vertices = ref_vertices(type);
+  auto faces = cell->get_entity_vertices(cell->dimension() - 1);
+  xt::xarray<double> e = xt::zeros<double>(std::vector<std::size_t>{np, faces.size() * nfp});
+  for (std::size_t f = 0; f < faces.size(); f++) {
+    std::vector<Point> p;
+    for (auto v : faces[f]) p.push_back(vertices[v]);
+    auto face = find_face_nodes(*ref, p);
+    auto mf = face_mass_matrix(type, order, face.coords);
+    for (std::size_t i = 0; i < nfp; i++) {
+      for (std::size_t j = 0; j < nfp; j++) e(face.nodes[i], f * nfp + j) = mf(i, j);
+    }
+    ops.face_nodes.push_back(std::move(face.nodes));
+    ops.face_mass.push_back(std::move(mf));
+  }
+  ops.lift = xt::linalg::dot(ops.inv_mass, e);
+  return ops;
+}
+
+}  // namespace
+
+const RefOperators &ref_operators(RefElementType type, unsigned order) {
+  using Key = std::pair<RefElementType, unsigned>;
+  static std::map<Key, RefOperators> cache;
+  static std::mutex mutex;
+  return oiseau::utils::cached(cache, mutex, Key{type, order},
+                               [&] { return make_operators(type, order); });
+}
+
+xt::xarray<double> affine_jacobian(RefElementType type, const xt::xarray<double> &vertices) {
+  const auto axes = affine_vertices(type);
+  const std::size_t dim = axes.size();
+  if (vertices.dimension() != 2 || vertices.shape()[1] < dim) {
+    throw std::invalid_argument("Vertices must be given as an nv x gdim array");
+  }
+  xt::xarray<double> jacobian = xt::zeros<double>(std::vector<std::size_t>{dim, dim});
+  for (std::size_t c = 0; c < dim; c++) {
+    for (std::size_t k = 0; k < dim; k++) {
+      jacobian(k, c) = 0.5 * (vertices(axes[c], k) - vertices(0, k));
+    }
+  }
+  return jacobian;
+}
+
+xt::xarray<double> element_mass(const RefOperators &ops, const xt::xarray<double> &jacobian) {
+  return std::abs(xt::linalg::det(jacobian)) * ops.mass;
+}
+
+xt::xarray<double> element_inv_mass(const RefOperators &ops, const xt::xarray<double> &jacobian) {
+  return ops.inv_mass / std::abs(xt::linalg::det(jacobian));
+}
+
+xt::xarray<double> element_stiffness(const RefOperators &ops, const xt::xarray<double> &jacobian,
+                                     std::size_t direction) {
+  auto inv_j = xt::linalg::inv(jacobian);
+  xt::xarray<double> s = xt::zeros_like(ops.mass);
+  for (std::size_t i = 0; i < ops.stiffness.size(); i++) {
+    s += inv_j(i, direction) * ops.stiffness[i];
+  }
+  return std::abs(xt::linalg::det(jacobian)) * s;
+}
+
+}  // namespace oiseau::dg::nodal
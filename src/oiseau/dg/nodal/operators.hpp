@@ -0,0 +1,57 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <xtensor/containers/xarray.hpp>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+
+namespace oiseau::dg::nodal {
+
+/**
+ * @brief Operators of a reference element, built on first use and shared afterwards.
+ *
+ * The modal basis is orthonormal, so M = (V V^T)^-1 and M^-1 = V V^T need no dense inverse.
+ * `stiffness[i]` is S_i = M D_i, i.e. S_i(j, k) = (l_j, d l_k / d r_i). Faces follow the
+ * `mesh::Cell` facet numbering; `face_nodes[f]` lists the element nodes on face f, running
+ * from the first face vertex for 2D cells. `lift` (np x n_faces * nfp) is M^-1 E, with E
+ * scattering the face mass matrices onto the face nodes, face after face.
+ */
+struct RefOperators {
+  xt::xarray<double> mass;
+  xt::xarray<double> inv_mass;
+  xt::xarray<double> mass_cholesky;
+  std::vector<xt::xarray<double>> stiffness;
+  std::vector<std::vector<std::size_t>> face_nodes;
+  std::vector<xt::xarray<double>> face_mass;
+  xt::xarray<double> lift;
+};
+
+const RefOperators &ref_operators(RefElementType type, unsigned order);
+
+/**
+ * @brief Jacobian dx/dr of the affine map onto a cell with the given vertices (nv x gdim).
+ *
+ * Quadrilaterals and hexahedra are assumed to be parallelograms/parallelepipeds, and only the
+ * first `dim` coordinates are used, e.g. x and y of a planar mesh stored in 3D.
+ */
+xt::xarray<double> affine_jacobian(RefElementType type, const xt::xarray<double> &vertices);
+
+/**
+ * @brief Operators of an affine cell, scaled from the reference ones on the fly.
+ *
+ * Only the cell jacobian needs to be stored: the mass is |J| M, its inverse M^-1 / |J| and the
+ * stiffness along x_k is |J| sum_i S_i (J^-1)(i, k).
+ */
+xt::xarray<double> element_mass(const RefOperators &ops, const xt::xarray<double> &jacobian);
+xt::xarray<double> element_inv_mass(const RefOperators &ops, const xt::xarray<double> &jacobian);
+xt::xarray<double> element_stiffness(const RefOperators &ops, const xt::xarray<double> &jacobian,
+                                     std::size_t direction);
+
+}  // namespace oiseau::dg::nodal
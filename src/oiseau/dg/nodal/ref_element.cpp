@@ -9,6 +9,7 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <unordered_map>
 #include <utility>
@@ -18,6 +19,7 @@
 #include "oiseau/dg/nodal/ref_quadrilateral.hpp"
 #include "oiseau/dg/nodal/ref_tetrahedron.hpp"
 #include "oiseau/dg/nodal/ref_triangle.hpp"
+#include "oiseau/utils/cache.hpp"
 
 namespace oiseau::dg::nodal {
 
@@ -31,36 +33,25 @@ std::shared_ptr<RefElement> get_ref_element(RefElementType type, unsigned order)
   };
 
   static std::unordered_map<Key, std::shared_ptr<RefElement>, KeyHash> cache;
-
-  Key key{type, order};
-  auto it = cache.find(key);
-  if (it != cache.end()) {
-    return it->second;
-  }
-
-  std::shared_ptr<RefElement> elem;
-  switch (type) {
-  case RefElementType::Line:
-    elem = std::make_shared<RefLine>(order);
-    break;
-  case RefElementType::Triangle:
-    elem = std::make_shared<RefTriangle>(order);
-    break;
-  case RefElementType::Quadrilateral:
-    elem = std::make_shared<RefQuadrilateral>(order);
-    break;
-  case RefElementType::Tetrahedron:
-    elem = std::make_shared<RefTetrahedron>(order);
-    break;
-  case RefElementType::Hexahedron:
-    elem = std::make_shared<RefHexahedron>(order);
-    break;
-  default:
-    throw std::invalid_argument("Unknown element type");
-  }
-
-  cache[key] = elem;
-  return elem;
+  static std::mutex mutex;
+
+  auto make = [&]() -> std::shared_ptr<RefElement> {
+    switch (type) {
+    case RefElementType::Line:
+      return std::make_shared<RefLine>(order);
+    case RefElementType::Triangle:
+      return std::make_shared<RefTriangle>(order);
+    case RefElementType::Quadrilateral:
+      return std::make_shared<RefQuadrilateral>(order);
+    case RefElementType::Tetrahedron:
+      return std::make_shared<RefTetrahedron>(order);
+    case RefElementType::Hexahedron:
+      return std::make_shared<RefHexahedron>(order);
+    default:
+      throw std::invalid_argument("Unknown element type");
+    }
+  };
+  return oiseau::utils::cached(cache, mutex, Key{type, order}, make);
 }
 
 }  // namespace oiseau::dg::nodal
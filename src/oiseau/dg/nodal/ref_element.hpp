@@ -25,6 +25,7 @@ class RefElement {
   inline const xt::xarray<double>& d() const { return m_d; }
   inline const xt::xarray<double>& r() const { return m_r; }
 
+  inline RefElementType type() const { return m_type; }
   inline unsigned order() const { return m_order; }
   inline unsigned number_of_nodes() const { return m_np; }
   inline unsigned number_of_face_nodes() const { return m_nfp; }
@@ -36,6 +37,7 @@ class RefElement {
     if (order == 0) throw std::invalid_argument("Order must be greater than 0");
   }
 
+  RefElementType m_type{};
   unsigned m_order;
   unsigned m_np{};
   unsigned m_nfp{};
@@ -22,6 +22,7 @@
 namespace oiseau::dg::nodal {
 
 RefLine::RefLine(unsigned order) : RefElement(order) {
+  this->m_type = RefElementType::Line;
   this->m_np = order + 1;
   this->m_nfp = 1;
   this->m_r = detail::generate_line_nodes(this->m_order);
@@ -22,6 +22,7 @@
 namespace oiseau::dg::nodal {
 
 RefQuadrilateral::RefQuadrilateral(unsigned order) : RefElement(order) {
+  this->m_type = RefElementType::Quadrilateral;
   this->m_np = (order + 1) * (order + 1);
   this->m_nfp = order + 1;
   this->m_r = detail::generate_quadrilateral_nodes(this->m_order);
@@ -27,6 +27,7 @@
 namespace oiseau::dg::nodal {
 
 RefTetrahedron::RefTetrahedron(unsigned order) : RefElement(order) {
+  this->m_type = RefElementType::Tetrahedron;
   this->m_np = ((order + 1) * (order + 2) * (order + 3)) / 6;
   this->m_nfp = ((order + 1) * (order + 2)) / 2;
   this->m_r = detail::equilateral_xyz_to_rst(detail::generate_tetrahedron_nodes(this->m_order));
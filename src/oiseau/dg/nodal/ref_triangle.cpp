@@ -27,6 +27,7 @@
 namespace oiseau::dg::nodal {
 
 RefTriangle::RefTriangle(unsigned order) : RefElement(order) {
+  this->m_type = RefElementType::Triangle;
   this->m_np = ((order + 1) * (order + 2)) / 2;
   this->m_nfp = order + 1;
   this->m_r = detail::equilateral_xy_to_rs(detail::generate_triangle_nodes(this->m_order));
@@ -0,0 +1,74 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/dg/nodal/transfer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/containers/xadapt.hpp>
+#include <xtensor/containers/xarray.hpp>
+#include <xtensor/misc/xmanipulation.hpp>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/utils/cache.hpp"
+
+namespace oiseau::dg::nodal {
+
+namespace {
+
+xt::xarray<double> make_transfer_matrix(RefElementType type, unsigned from, unsigned to,
+                                        TransferKind kind) {
+  auto from_ref = get_ref_element(type, from);
+  auto to_ref = get_ref_element(type, to);
+  if (kind == TransferKind::Interpolation || to >= from) {
+    return interpolation_matrix(*from_ref, to_ref->r());
+  }
+  // with an orthonormal modal basis, M = (V V^T)^-1
+  auto interp = interpolation_matrix(*to_ref, from_ref->r());
+  auto inv_mass_to = xt::linalg::dot(to_ref->v(), xt::transpose(to_ref->v()));
+  auto mass_from = xt::linalg::inv(xt::linalg::dot(from_ref->v(), xt::transpose(from_ref->v())));
+  return xt::linalg::dot(inv_mass_to, xt::linalg::dot(xt::transpose(interp), mass_from));
+}
+
+}  // namespace
+
+xt::xarray<double> interpolation_matrix(const RefElement &ref, const xt::xarray<double> &points) {
+  return xt::linalg::dot(ref.vandermonde(points), xt::linalg::inv(ref.v()));
+}
+
+const xt::xarray<double> &transfer_matrix(RefElementType type, unsigned from, unsigned to,
+                                          TransferKind kind) {
+  using Key = std::tuple<RefElementType, unsigned, unsigned, TransferKind>;
+  static std::map<Key, xt::xarray<double>> cache;
+  static std::mutex mutex;
+  return oiseau::utils::cached(cache, mutex, Key{type, from, to, kind},
+                               [&] { return make_transfer_matrix(type, from, to, kind); });
+}
+
+void apply_blocks(const xt::xarray<double> &op, std::span<const double> u, std::span<double> v) {
+  const std::size_t n_rows = op.shape()[0];
+  const std::size_t n_cols = op.shape()[1];
+  if (u.size() % n_cols != 0 || v.size() != u.size() / n_cols * n_rows) {
+    throw std::invalid_argument("Block sizes do not match the operator");
+  }
+  const std::size_t n_blocks = u.size() / n_cols;
+  if (n_blocks == 0) return;
+
+  // blocks are rows of U, so V = U op^T
+  std::array<std::size_t, 2> shape = {n_blocks, n_cols};
+  auto u_blocks = xt::adapt(u.data(), u.size(), xt::no_ownership(), shape);
+  xt::xarray<double> v_blocks = xt::linalg::dot(u_blocks, xt::transpose(op));
+  std::copy(v_blocks.begin(), v_blocks.end(), v.begin());
+}
+
+}  // namespace oiseau::dg::nodal
@@ -0,0 +1,45 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <span>
+#include <xtensor/containers/xarray.hpp>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+
+namespace oiseau::dg::nodal {
+
+enum class TransferKind { Interpolation, Projection };
+
+/**
+ * @brief Evaluates the nodal basis of `ref` at reference `points`.
+ *
+ * Returns a points x nodes matrix mapping nodal values to values at the points, e.g. for
+ * resampling output.
+ */
+xt::xarray<double> interpolation_matrix(const RefElement &ref, const xt::xarray<double> &points);
+
+/**
+ * @brief Maps nodal values of order `from` to nodal values of order `to` on the same cell type.
+ *
+ * Interpolation evaluates the `from` polynomial at the `to` nodes. Projection is the L2
+ * projection `M_to^-1 I^T M_from`, with I interpolating from `to` back to `from`; it keeps the
+ * mean and every polynomial of the lower order, and equals interpolation when the order rises.
+ * Matrices are built once per (type, from, to, kind) and cached. Returns a `to` x `from` nodes
+ * matrix.
+ */
+const xt::xarray<double> &transfer_matrix(RefElementType type, unsigned from, unsigned to,
+                                          TransferKind kind = TransferKind::Projection);
+
+/**
+ * @brief Applies `op` to consecutive blocks of `u` with a single matrix product.
+ *
+ * `u` holds n blocks of `op.shape(1)` values and `v` receives n blocks of `op.shape(0)` values.
+ */
+void apply_blocks(const xt::xarray<double> &op, std::span<const double> u, std::span<double> v);
+
+}  // namespace oiseau::dg::nodal
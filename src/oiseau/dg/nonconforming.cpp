@@ -0,0 +1,43 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/dg/nonconforming.hpp"
+
+#include <stdexcept>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/containers/xarray.hpp>
+#include <xtensor/misc/xmanipulation.hpp>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+
+namespace oiseau::dg {
+
+xt::xarray<double> face_interpolation_matrix(unsigned coarse_order, unsigned fine_order,
+                                             int half, bool reversed) {
+  if (half != 0 && half != 1) throw std::invalid_argument("Face half must be 0 or 1");
+  auto coarse = nodal::get_ref_element(nodal::RefElementType::Line, coarse_order);
+  auto fine = nodal::get_ref_element(nodal::RefElementType::Line, fine_order);
+
+  // fine face nodes in the coordinate of the coarse face
+  xt::xarray<double> t = reversed ? xt::xarray<double>(-fine->r()) : fine->r();
+  xt::xarray<double> s = 0.5 * (t + (half == 0 ? -1.0 : 1.0));
+  return xt::linalg::dot(coarse->vandermonde(s), xt::linalg::inv(coarse->v()));
+}
+
+xt::xarray<double> face_projection_matrix(unsigned coarse_order, unsigned fine_order, int half,
+                                          bool reversed) {
+  auto coarse = nodal::get_ref_element(nodal::RefElementType::Line, coarse_order);
+  auto fine = nodal::get_ref_element(nodal::RefElementType::Line, fine_order);
+  auto interp = face_interpolation_matrix(coarse_order, fine_order, half, reversed);
+
+  // P = Mc^-1 (I^T Mf) / 2, the half face being mapped to the reference line with jacobian 1/2
+  auto inv_mass_coarse = xt::linalg::dot(coarse->v(), xt::transpose(coarse->v()));
+  auto mass_fine = xt::linalg::inv(xt::linalg::dot(fine->v(), xt::transpose(fine->v())));
+  return 0.5 * xt::linalg::dot(inv_mass_coarse,
+                               xt::linalg::dot(xt::transpose(interp), mass_fine));
+}
+
+}  // namespace oiseau::dg
@@ -0,0 +1,34 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <xtensor/containers/xarray.hpp>
+
+namespace oiseau::dg {
+
+/**
+ * @brief Interpolates the nodal values on a coarse face to the nodes of one of its halves.
+ *
+ * Faces of 2D elements carry the line nodes of their order, running from the first to the
+ * second face vertex. Half 0 starts at the first vertex of the coarse face; `reversed` tells
+ * whether the fine face runs against the coarse one (see `mesh::NonConformingFace`).
+ * Returns a (fine_order + 1) x (coarse_order + 1) matrix.
+ */
+xt::xarray<double> face_interpolation_matrix(unsigned coarse_order, unsigned fine_order,
+                                             int half, bool reversed);
+
+/**
+ * @brief L2 projection of the nodal values on one half face back to the coarse face.
+ *
+ * Summing the projections of both halves of an interpolated coarse field gives the field back,
+ * so fluxes computed on the fine side can be lifted onto the coarse side conservatively.
+ * Returns a (coarse_order + 1) x (fine_order + 1) matrix.
+ */
+xt::xarray<double> face_projection_matrix(unsigned coarse_order, unsigned fine_order, int half,
+                                          bool reversed);
+
+}  // namespace oiseau::dg
@@ -0,0 +1,123 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/dg/time_integration.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace oiseau::dg {
+
+namespace detail {
+
+const RKCoefficients &rk_coefficients(RKScheme scheme) {
+  static const RKCoefficients lserk4 = [] {
+    // Carpenter & Kennedy (1994), coefficients of their 2N-storage scheme
+    RKCoefficients k;
+    k.a = {0.0, -567301805773.0 / 1357537059087.0, -2404267990393.0 / 2016746695238.0,
+           -3550918686646.0 / 2091501179385.0, -1275806237668.0 / 842570457699.0};
+    k.b = {1432997174477.0 / 9575080441955.0, 5161836677717.0 / 13612068292357.0,
+           1720146321549.0 / 2090206949498.0, 3134564353537.0 / 4481467310338.0,
+           2277821191437.0 / 14882151754819.0};
+    k.c = {0.0, 1432997174477.0 / 9575080441955.0, 2526269341429.0 / 6820363962896.0,
+           2006345519317.0 / 3224310063776.0, 2802321613138.0 / 2924317926251.0};
+    // L_j reaches u through every later stage: weight_j = sum_{s >= j} b_s prod_{j < m <= s} a_m
+    const std::size_t n = k.a.size();
+    k.weight.assign(n, 0.0);
+    for (std::size_t j = 0; j < n; j++) {
+      double carry = 1.0;
+      for (std::size_t s = j; s < n; s++) {
+        if (s > j) carry *= k.a[s];
+        k.weight[j] += k.b[s] * carry;
+      }
+    }
+    return k;
+  }();
+  // Shu & Osher (1988)
+  static const RKCoefficients ssprk3 = {
+      {0.0, 3.0 / 4.0, 1.0 / 3.0},
+      {1.0, 1.0 / 4.0, 2.0 / 3.0},
+      {0.0, 1.0, 1.0 / 2.0},
+      {1.0 / 6.0, 1.0 / 6.0, 2.0 / 3.0},
+  };
+  return scheme == RKScheme::LSERK4 ? lserk4 : ssprk3;
+}
+
+void rk_stage(RKScheme scheme, std::size_t stage, double dt, std::size_t n, double *u, double *w,
+              const double *dudt) {
+  const auto &k = rk_coefficients(scheme);
+  const double a = k.a[stage];
+  const double b = k.b[stage];
+  switch (scheme) {
+  case RKScheme::LSERK4:
+    // the first stage has a = 0, which also discards the residual of the previous step
+    if (stage == 0) {
+#pragma omp parallel for
+      for (std::size_t i = 0; i < n; i++) {
+        w[i] = dt * dudt[i];
+        u[i] += b * w[i];
+      }
+    } else {
+#pragma omp parallel for
+      for (std::size_t i = 0; i < n; i++) {
+        w[i] = a * w[i] + dt * dudt[i];
+        u[i] += b * w[i];
+      }
+    }
+    break;
+  case RKScheme::SSPRK3:
+    if (stage == 0) {
+#pragma omp parallel for
+      for (std::size_t i = 0; i < n; i++) {
+        w[i] = u[i];
+        u[i] += dt * dudt[i];
+      }
+    } else {
+#pragma omp parallel for
+      for (std::size_t i = 0; i < n; i++) u[i] = a * w[i] + b * (u[i] + dt * dudt[i]);
+    }
+    break;
+  }
+}
+
+}  // namespace detail
+
+LowStorageRK::LowStorageRK(RKScheme scheme, std::size_t n_dofs)
+    : m_scheme(scheme), m_dudt(n_dofs), m_register(n_dofs) {}
+
+std::size_t LowStorageRK::n_stages() const { return detail::rk_coefficients(m_scheme).a.size(); }
+
+void LowStorageRK::step(const RHSFunction &rhs, double t, double dt, std::span<double> u) {
+  const std::size_t n = m_dudt.size();
+  if (u.size() != n) throw std::invalid_argument("Field size does not match the stepper");
+  const auto &k = detail::rk_coefficients(m_scheme);
+  for (std::size_t s = 0; s < k.a.size(); s++) {
+    rhs(t + k.c[s] * dt, u, m_dudt);
+    detail::rk_stage(m_scheme, s, dt, n, u.data(), m_register.data(), m_dudt.data());
+  }
+}
+
+std::size_t LowStorageRK::integrate(const RHSFunction &rhs, double t0, double t1, double dt,
+                                    std::span<double> u) {
+  if (!(dt > 0.0)) throw std::invalid_argument("Time step must be positive");
+  std::size_t n_steps = 0;
+  double t = t0;
+  // steps within a relative tolerance of t1 end the run instead of leaving a sliver behind
+  const double eps = 1e-12 * std::max(std::abs(t1), dt);
+  while (t1 - t > eps) {
+    const double h = std::min(dt, t1 - t);
+    step(rhs, t, h, u);
+    t += h;
+    n_steps++;
+  }
+  return n_steps;
+}
+
+}  // namespace oiseau::dg
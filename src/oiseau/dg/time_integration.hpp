@@ -0,0 +1,84 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace oiseau::dg {
+
+/// Writes du/dt at time t for the field u into `dudt`; `dudt` has the size of u.
+using RHSFunction =
+    std::function<void(double t, std::span<const double> u, std::span<double> dudt)>;
+
+enum class RKScheme {
+  /// Carpenter & Kennedy five-stage, fourth-order scheme in Williamson form (one residual).
+  LSERK4,
+  /// Shu & Osher three-stage, third-order strong stability preserving scheme.
+  SSPRK3,
+};
+
+namespace detail {
+
+/**
+ * @brief Coefficients of the low-storage schemes.
+ *
+ * LSERK4 stages do w = a w + dt L(u), u += b w. SSPRK3 stages do u = a u0 + b (u + dt L(u)),
+ * with u0 kept in w. `c` holds the stage times and `weight` the share of each stage's L(u) in
+ * the completed step, u1 = u0 + dt sum_s weight_s L_s.
+ */
+struct RKCoefficients {
+  std::vector<double> a;
+  std::vector<double> b;
+  std::vector<double> c;
+  std::vector<double> weight;
+};
+
+const RKCoefficients &rk_coefficients(RKScheme scheme);
+
+/// Fused update of stage `stage` over n entries, once L(u) has been written to `dudt`.
+void rk_stage(RKScheme scheme, std::size_t stage, double dt, std::size_t n, double *u, double *w,
+              const double *dudt);
+
+}  // namespace detail
+
+/**
+ * @brief Explicit Runge-Kutta stepper updating a contiguous field in place.
+ *
+ * Storage is 3N for a field of N values: the field itself, the right-hand side output and either
+ * the stage residual (LSERK4) or the field at the start of the step (SSPRK3). Every stage does a
+ * single fused pass over them after the right-hand side has been evaluated. The 2N form of the
+ * LSERK4 scheme would need the right-hand side to accumulate into the residual register, which
+ * `RHSFunction` does not do.
+ */
+class LowStorageRK {
+ public:
+  LowStorageRK(RKScheme scheme, std::size_t n_dofs);
+
+  RKScheme scheme() const { return m_scheme; }
+  std::size_t n_stages() const;
+
+  /// Advances `u` from t to t + dt.
+  void step(const RHSFunction &rhs, double t, double dt, std::span<double> u);
+
+  /**
+   * @brief Advances `u` from t0 to t1 with steps of at most dt, shortening the last one.
+   *
+   * Returns the number of steps taken.
+   */
+  std::size_t integrate(const RHSFunction &rhs, double t0, double t1, double dt,
+                        std::span<double> u);
+
+ private:
+  RKScheme m_scheme;
+  std::vector<double> m_dudt;
+  std::vector<double> m_register;
+};
+
+}  // namespace oiseau::dg
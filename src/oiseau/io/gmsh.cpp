@@ -6,10 +6,14 @@
 
 #include "oiseau/io/gmsh.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <filesystem>
 #include <fstream>
 #include <istream>
+#include <limits>
+#include <map>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -39,6 +43,74 @@ oiseau::mesh::CellType gmsh_celltype_to_oiseau_celltype(const std::size_t s) {
 
   return oiseau::mesh::get_cell_type(it->second);
 }
+
+std::array<std::unordered_map<int, int>, 4> gmsh_entity_physical_tags(
+    const EntitiesSection &entities) {
+  std::array<std::unordered_map<int, int>, 4> tags;
+  for (std::size_t d = 0; d < entities.blocks.size(); d++) {
+    for (const auto &entity : entities.blocks[d]) {
+      if (entity.physical_tags.empty()) continue;
+      tags[d].emplace(static_cast<int>(entity.tag), entity.physical_tags.front());
+    }
+  }
+  return tags;
+}
+
+NodeTagMap::NodeTagMap(const NodesSection &nodes) {
+  std::size_t num_nodes = 0;
+  std::size_t min_tag = std::numeric_limits<std::size_t>::max();
+  std::size_t max_tag = 0;
+  for (const auto &block : nodes.blocks) {
+    num_nodes += block.node_tags.size();
+    for (auto tag : block.node_tags) {
+      min_tag = std::min(min_tag, tag);
+      max_tag = std::max(max_tag, tag);
+    }
+  }
+  if (num_nodes == 0) return;
+
+  m_min_tag = min_tag;
+  m_dense_lookup = (max_tag - min_tag + 1) <= DENSE_TAG_RATIO * num_nodes;
+  if (m_dense_lookup) {
+    m_dense.assign(max_tag - min_tag + 1, INVALID);
+  } else {
+    m_sparse.reserve(num_nodes);
+  }
+
+  // indices follow the order in which the node blocks were concatenated into the geometry
+  std::size_t index = 0;
+  for (const auto &block : nodes.blocks) {
+    for (auto tag : block.node_tags) {
+      if (m_dense_lookup) {
+        m_dense[tag - m_min_tag] = index++;
+      } else {
+        m_sparse.emplace(tag, index++);
+      }
+    }
+  }
+}
+
+std::size_t NodeTagMap::operator()(std::size_t tag) const {
+  if (m_dense_lookup) {
+    if (tag < m_min_tag || tag - m_min_tag >= m_dense.size()) return INVALID;
+    return m_dense[tag - m_min_tag];
+  }
+  auto it = m_sparse.find(tag);
+  return (it != m_sparse.end()) ? it->second : INVALID;
+}
+
+std::map<std::pair<int, int>, std::string> gmsh_physical_names(
+    const PhysicalNamesSection &section) {
+  std::map<std::pair<int, int>, std::string> names;
+  for (int i = 0; i < section.num_physical_names; i++) {
+    std::string name = section.names[i];
+    if (name.size() >= 2 && name.front() == '"' && name.back() == '"') {
+      name = name.substr(1, name.size() - 2);
+    }
+    names.emplace(std::pair{section.dimensions[i], section.physical_tags[i]}, std::move(name));
+  }
+  return names;
+}
 }  // namespace detail
 
 oiseau::mesh::Mesh gmsh_read_from_string(const std::string &content) {
@@ -54,32 +126,74 @@ oiseau::mesh::Mesh gmsh_read_from_path(const std::filesystem::path &path) {
 oiseau::mesh::Mesh gmsh_read_from_stream(std::istream &f_handler) {
   GMSHFile file = GMSHFile(f_handler);
   std::vector<double> x;
-  std::vector<std::vector<std::size_t>> conn;
-  std::vector<oiseau::mesh::CellType> cell_types;
 
   x.reserve(file.nodes_section.num_nodes * 3);
   for (auto &block : file.nodes_section.blocks) {
     x.insert(x.end(), block.node_coords.begin(), block.node_coords.end());
   }
+  const detail::NodeTagMap node_index(file.nodes_section);
+
+  // cells are the highest-dimensional elements; one dimension below are the boundary facets
+  int dim = 0;
+  for (const auto &block : file.elements_section.blocks) dim = std::max(dim, block.entity_dim);
+  auto entity_tags = detail::gmsh_entity_physical_tags(file.entities_section);
+
+  // first pass: where each kept block starts in the cell or facet arrays
+  const auto &blocks = file.elements_section.blocks;
+  std::vector<std::size_t> offsets(blocks.size(), 0);
+  std::vector<oiseau::mesh::CellType> block_types(blocks.size(), nullptr);
+  std::vector<int> block_tags(blocks.size(), oiseau::mesh::UNTAGGED);
+  std::size_t num_cells = 0;
+  std::size_t num_facets = 0;
+  for (std::size_t b = 0; b < blocks.size(); ++b) {
+    const auto &block = blocks[b];
+    if (block.entity_dim != dim && block.entity_dim != dim - 1) continue;
+    std::size_t &count = (block.entity_dim == dim) ? num_cells : num_facets;
+    offsets[b] = count;
+    count += block.num_elements_in_block;
+
+    const auto &tags = entity_tags.at(block.entity_dim);
+    auto tag_it = tags.find(block.entity_tag);
+    if (tag_it != tags.end()) block_tags[b] = tag_it->second;
+    block_types[b] = detail::gmsh_celltype_to_oiseau_celltype(block.element_type);
+  }
 
-  cell_types.reserve(file.elements_section.num_elements);
-  conn.reserve(file.elements_section.num_elements);
+  std::vector<std::vector<std::size_t>> conn(num_cells);
+  std::vector<oiseau::mesh::CellType> cell_types(num_cells);
+  std::vector<int> cell_tags(num_cells);
+  std::vector<std::vector<std::size_t>> facets(num_facets);
+  std::vector<int> facet_tags(num_facets);
 
-  for (const auto &block : file.elements_section.blocks) {
+  // second pass: remap node tags to geometry indices, independently for every element
+  bool missing_node = false;
+  for (std::size_t b = 0; b < blocks.size(); ++b) {
+    const auto &block = blocks[b];
+    if (block_types[b] == nullptr || block.num_elements_in_block == 0) continue;
+    bool is_cell = block.entity_dim == dim;
+    auto &out_conn = is_cell ? conn : facets;
+    auto &out_tags = is_cell ? cell_tags : facet_tags;
     std::size_t elem_size = block.data.size() / block.num_elements_in_block;
-    for (std::size_t i = 0; i < block.num_elements_in_block; ++i) {
-      std::vector<std::size_t> tmp;
-      tmp.reserve(elem_size - 1);
+    std::size_t num_elements = block.num_elements_in_block;
+
+#pragma omp parallel for reduction(|| : missing_node)
+    for (std::size_t i = 0; i < num_elements; ++i) {
+      std::vector<std::size_t> tmp(elem_size - 1);
       for (std::size_t j = 1; j < elem_size; ++j) {
-        tmp.emplace_back(block.data[i * elem_size + j] - 1);
+        tmp[j - 1] = node_index(block.data[i * elem_size + j]);
+        missing_node = missing_node || tmp[j - 1] == detail::NodeTagMap::INVALID;
       }
-      cell_types.emplace_back(detail::gmsh_celltype_to_oiseau_celltype(block.element_type));
-      conn.emplace_back(std::move(tmp));
+      out_conn[offsets[b] + i] = std::move(tmp);
+      out_tags[offsets[b] + i] = block_tags[b];
+      if (is_cell) cell_types[offsets[b] + i] = block_types[b];
     }
   }
+  if (missing_node) throw std::runtime_error("Gmsh element references an undefined node tag");
 
   oiseau::mesh::Geometry geometry = oiseau::mesh::Geometry(std::move(x), 3);
-  oiseau::mesh::Topology topology = oiseau::mesh::Topology(std::move(conn), std::move(cell_types));
+  oiseau::mesh::Topology topology =
+      oiseau::mesh::Topology(std::move(conn), std::move(cell_types), std::move(cell_tags));
+  topology.set_boundary_facets(std::move(facets), std::move(facet_tags));
+  topology.set_physical_names(detail::gmsh_physical_names(file.physical_names_section));
   oiseau::mesh::Mesh mesh(std::move(topology), std::move(geometry));
   return mesh;
 };
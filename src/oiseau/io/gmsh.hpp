@@ -6,17 +6,57 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <filesystem>
 #include <istream>
+#include <limits>
+#include <map>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include "oiseau/io/gmsh_file.hpp"
 #include "oiseau/mesh/cell.hpp"
 #include "oiseau/mesh/mesh.hpp"
 
 namespace oiseau::io::detail {
 oiseau::mesh::CellType gmsh_celltype_to_oiseau_celltype(const std::size_t s);
-}
+
+/// Maps each entity tag to its first physical tag, one map per entity dimension.
+std::array<std::unordered_map<int, int>, 4> gmsh_entity_physical_tags(
+    const EntitiesSection& entities);
+
+/**
+ * @brief Maps Gmsh node tags to indices into the concatenated node coordinates.
+ *
+ * Node tags need not be contiguous nor start at 1. When the tag range is at most
+ * `DENSE_TAG_RATIO` times the number of nodes the lookup is a dense array indexed by
+ * `tag - min_tag`; otherwise a hash map is used. Lookups are read-only and thread-safe.
+ */
+class NodeTagMap {
+ public:
+  static constexpr std::size_t INVALID = std::numeric_limits<std::size_t>::max();
+  static constexpr std::size_t DENSE_TAG_RATIO = 2;
+
+  explicit NodeTagMap(const NodesSection& nodes);
+
+  /// Returns the node index for `tag`, or INVALID if no node has this tag.
+  std::size_t operator()(std::size_t tag) const;
+  bool is_dense() const { return m_dense_lookup; }
+
+ private:
+  std::size_t m_min_tag = 0;
+  bool m_dense_lookup = true;
+  std::vector<std::size_t> m_dense;
+  std::unordered_map<std::size_t, std::size_t> m_sparse;
+};
+
+/// Collects the physical group names keyed by (dimension, physical tag), without quotes.
+std::map<std::pair<int, int>, std::string> gmsh_physical_names(
+    const PhysicalNamesSection& section);
+}  // namespace oiseau::io::detail
 
 namespace oiseau::io {
 oiseau::mesh::Mesh gmsh_read_from_path(const std::filesystem::path& path);
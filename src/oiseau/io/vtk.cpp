@@ -0,0 +1,288 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/io/vtk.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/containers/xarray.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+
+#include "oiseau/dg/dg_space.hpp"
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/dg/nodal/transfer.hpp"
+#include "oiseau/utils/cache.hpp"
+
+namespace oiseau::io {
+
+namespace {
+
+using dg::nodal::RefElementType;
+
+constexpr const char *BYTE_ORDER =
+    std::endian::native == std::endian::little ? "LittleEndian" : "BigEndian";
+
+std::uint8_t vtk_cell_type(RefElementType type, unsigned order) {
+  switch (type) {
+  case RefElementType::Line:
+    return order == 1 ? 3 : 68;  // VTK_LINE, VTK_LAGRANGE_CURVE
+  case RefElementType::Triangle:
+    return order == 1 ? 5 : 69;  // VTK_TRIANGLE, VTK_LAGRANGE_TRIANGLE
+  case RefElementType::Quadrilateral:
+    return order == 1 ? 9 : 70;  // VTK_QUAD, VTK_LAGRANGE_QUADRILATERAL
+  default:
+    throw std::invalid_argument("VTK output supports lines, triangles and quadrilaterals");
+  }
+}
+
+// lattice points (i, j) of the triangle of order q whose first vertex is (o, o)
+void triangle_lattice(int o, int q, std::vector<std::array<int, 2>> &out) {
+  if (q < 0) return;
+  if (q == 0) {
+    out.push_back({o, o});
+    return;
+  }
+  out.insert(out.end(), {{o, o}, {o + q, o}, {o, o + q}});
+  for (int t = 1; t < q; t++) out.push_back({o + t, o});
+  for (int t = 1; t < q; t++) out.push_back({o + q - t, o + t});
+  for (int t = 1; t < q; t++) out.push_back({o, o + q - t});
+  triangle_lattice(o + 1, q - 3, out);
+}
+
+// nodal values to the points of the VTK cell, cached per (type, order)
+const xt::xarray<double> &vtk_interpolation(RefElementType type, unsigned order) {
+  using Key = std::pair<RefElementType, unsigned>;
+  static std::map<Key, xt::xarray<double>> cache;
+  static std::mutex mutex;
+  return oiseau::utils::cached(cache, mutex, Key{type, order}, [&]() -> xt::xarray<double> {
+    auto ref = dg::nodal::get_ref_element(type, order);
+    auto v = ref->vandermonde(detail::vtk_lagrange_points(type, order));
+    return xt::linalg::dot(v, xt::linalg::inv(ref->v()));
+  });
+}
+
+struct AppendedArray {
+  std::string type;
+  std::string name;
+  unsigned n_components;
+  std::span<const std::byte> bytes;
+};
+
+template <class T>
+AppendedArray appended(std::string type, std::string name, unsigned n_components,
+                       std::span<const T> data) {
+  return {std::move(type), std::move(name), n_components, std::as_bytes(data)};
+}
+
+void write_data_array(std::ostream &out, const AppendedArray &array, std::uint64_t offset) {
+  out << "<DataArray type=\"" << array.type << "\"";
+  if (!array.name.empty()) out << " Name=\"" << array.name << "\"";
+  out << " NumberOfComponents=\"" << array.n_components << "\" format=\"appended\" offset=\""
+      << offset << "\"/>\n";
+}
+
+}  // namespace
+
+namespace detail {
+
+xt::xarray<double> vtk_lagrange_points(RefElementType type, unsigned order) {
+  const auto p = static_cast<int>(order);
+  std::vector<std::array<int, 2>> lattice;
+  switch (type) {
+  case RefElementType::Line:
+    lattice.push_back({0, 0});
+    lattice.push_back({p, 0});
+    for (int i = 1; i < p; i++) lattice.push_back({i, 0});
+    break;
+  case RefElementType::Triangle:
+    triangle_lattice(0, p, lattice);
+    break;
+  case RefElementType::Quadrilateral:
+    lattice.insert(lattice.end(), {{0, 0}, {p, 0}, {p, p}, {0, p}});
+    for (int i = 1; i < p; i++) lattice.push_back({i, 0});
+    for (int j = 1; j < p; j++) lattice.push_back({p, j});
+    for (int i = 1; i < p; i++) lattice.push_back({i, p});
+    for (int j = 1; j < p; j++) lattice.push_back({0, j});
+    for (int j = 1; j < p; j++) {
+      for (int i = 1; i < p; i++) lattice.push_back({i, j});
+    }
+    break;
+  default:
+    throw std::invalid_argument("VTK output supports lines, triangles and quadrilaterals");
+  }
+
+  const std::size_t n = lattice.size();
+  if (type == RefElementType::Line) {
+    xt::xarray<double> r = xt::zeros<double>(std::vector<std::size_t>{n});
+    for (std::size_t k = 0; k < n; k++) r(k) = -1.0 + 2.0 * lattice[k][0] / p;
+    return r;
+  }
+  xt::xarray<double> r = xt::zeros<double>(std::vector<std::size_t>{n, 2});
+  for (std::size_t k = 0; k < n; k++) {
+    r(k, 0) = -1.0 + 2.0 * lattice[k][0] / p;
+    r(k, 1) = -1.0 + 2.0 * lattice[k][1] / p;
+  }
+  return r;
+}
+
+}  // namespace detail
+
+void vtu_write(const std::filesystem::path &path, const dg::DGSpace &space,
+               std::span<const VTKField> fields, std::size_t n_cells) {
+  const auto elements = space.elements();
+  const auto offsets = space.offsets();
+  n_cells = std::min(n_cells, elements.size());
+  const std::size_t n_points = offsets[n_cells];
+  for (const auto &f : fields) {
+    if (f.n_components == 0 || f.values.size() != f.n_components * space.n_dofs()) {
+      throw std::invalid_argument("Field " + f.name + " does not match the space");
+    }
+  }
+
+  // one point per node, so the points of cell i are [offsets[i], offsets[i + 1])
+  std::vector<double> points(3 * n_points, 0.0);
+  std::vector<std::vector<double>> data(fields.size());
+  for (std::size_t f = 0; f < fields.size(); f++) data[f].resize(fields[f].n_components * n_points);
+  std::vector<std::int64_t> connectivity(n_points);
+  std::iota(connectivity.begin(), connectivity.end(), 0);
+  std::vector<std::int64_t> cell_offsets(offsets.begin() + 1, offsets.begin() + n_cells + 1);
+  std::vector<std::uint8_t> cell_types(n_cells);
+
+  using Key = std::pair<RefElementType, unsigned>;
+  std::map<Key, std::vector<std::size_t>> groups;
+  for (std::size_t i = 0; i < n_cells; i++) {
+    const auto &ref = elements[i].reference();
+    cell_types[i] = vtk_cell_type(ref.type(), ref.order());
+    groups[{ref.type(), ref.order()}].push_back(i);
+  }
+
+  std::vector<double> u_group, v_group;
+  for (const auto &[key, cells] : groups) {
+    const auto &op = vtk_interpolation(key.first, key.second);
+    const std::size_t np = op.shape()[0];
+    const auto n_group = static_cast<std::ptrdiff_t>(cells.size());
+    u_group.resize(cells.size() * np);
+    v_group.resize(cells.size() * np);
+
+    // gathers the nodal values of the group, interpolates them and scatters the results
+    auto interpolate = [&](auto &&get, auto &&put) {
+#pragma omp parallel for
+      for (std::ptrdiff_t k = 0; k < n_group; k++) {
+        for (std::size_t j = 0; j < np; j++) u_group[k * np + j] = get(cells[k], j);
+      }
+      dg::nodal::apply_blocks(op, u_group, v_group);
+#pragma omp parallel for
+      for (std::ptrdiff_t k = 0; k < n_group; k++) {
+        for (std::size_t j = 0; j < np; j++) put(cells[k], j, v_group[k * np + j]);
+      }
+    };
+
+    const std::size_t gdim = std::min<std::size_t>(elements[cells[0]].nodes().shape()[1], 3);
+    for (std::size_t d = 0; d < gdim; d++) {
+      interpolate([&](std::size_t c, std::size_t j) { return elements[c].nodes()(j, d); },
+                  [&](std::size_t c, std::size_t j, double value) {
+                    points[3 * (offsets[c] + j) + d] = value;
+                  });
+    }
+    for (std::size_t f = 0; f < fields.size(); f++) {
+      const unsigned nc = fields[f].n_components;
+      for (unsigned comp = 0; comp < nc; comp++) {
+        const double *u = fields[f].values.data() + comp * space.n_dofs();
+        interpolate([&](std::size_t c, std::size_t j) { return u[offsets[c] + j]; },
+                    [&](std::size_t c, std::size_t j, double value) {
+                      data[f][nc * (offsets[c] + j) + comp] = value;
+                    });
+      }
+    }
+  }
+
+  std::vector<AppendedArray> point_data;
+  for (std::size_t f = 0; f < fields.size(); f++) {
+    point_data.push_back(appended<double>("Float64", fields[f].name, fields[f].n_components,
+                                          data[f]));
+  }
+  const std::array<AppendedArray, 4> geometry = {
+      appended<double>("Float64", "", 3, points),
+      appended<std::int64_t>("Int64", "connectivity", 1, connectivity),
+      appended<std::int64_t>("Int64", "offsets", 1, cell_offsets),
+      appended<std::uint8_t>("UInt8", "types", 1, cell_types)};
+
+  std::ofstream out(path, std::ios::binary);
+  if (!out) throw std::runtime_error("Could not open " + path.string() + " for writing");
+  out << "<?xml version=\"1.0\"?>\n"
+      << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" << BYTE_ORDER
+      << "\" header_type=\"UInt64\">\n"
+      << "<UnstructuredGrid>\n"
+      << "<Piece NumberOfPoints=\"" << n_points << "\" NumberOfCells=\"" << n_cells << "\">\n";
+  std::uint64_t offset = 0;
+  auto declare = [&](const AppendedArray &array) {
+    write_data_array(out, array, offset);
+    offset += sizeof(std::uint64_t) + array.bytes.size();
+  };
+  out << "<PointData>\n";
+  for (const auto &array : point_data) declare(array);
+  out << "</PointData>\n<Points>\n";
+  declare(geometry[0]);
+  out << "</Points>\n<Cells>\n";
+  for (std::size_t k = 1; k < geometry.size(); k++) declare(geometry[k]);
+  out << "</Cells>\n</Piece>\n</UnstructuredGrid>\n<AppendedData encoding=\"raw\">\n_";
+
+  // each array is its byte count followed by its contents, each in one write
+  auto append = [&](const AppendedArray &array) {
+    const std::uint64_t n_bytes = array.bytes.size();
+    out.write(reinterpret_cast<const char *>(&n_bytes), sizeof(n_bytes));
+    out.write(reinterpret_cast<const char *>(array.bytes.data()),
+              static_cast<std::streamsize>(n_bytes));
+  };
+  for (const auto &array : point_data) append(array);
+  for (const auto &array : geometry) append(array);
+  out << "\n</AppendedData>\n</VTKFile>\n";
+  if (!out) throw std::runtime_error("Could not write " + path.string());
+}
+
+std::filesystem::path vtu_piece_path(const std::filesystem::path &pvtu_path, int rank) {
+  auto piece = pvtu_path;
+  piece.replace_filename(pvtu_path.stem().string() + "_" + std::to_string(rank) + ".vtu");
+  return piece;
+}
+
+void pvtu_write(const std::filesystem::path &path, int n_pieces,
+                std::span<const VTKField> fields) {
+  std::ofstream out(path);
+  if (!out) throw std::runtime_error("Could not open " + path.string() + " for writing");
+  out << "<?xml version=\"1.0\"?>\n"
+      << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" byte_order=\"" << BYTE_ORDER
+      << "\" header_type=\"UInt64\">\n"
+      << "<PUnstructuredGrid GhostLevel=\"0\">\n<PPointData>\n";
+  for (const auto &f : fields) {
+    out << "<PDataArray type=\"Float64\" Name=\"" << f.name << "\" NumberOfComponents=\""
+        << f.n_components << "\"/>\n";
+  }
+  out << "</PPointData>\n<PPoints>\n"
+      << "<PDataArray type=\"Float64\" NumberOfComponents=\"3\"/>\n</PPoints>\n";
+  for (int rank = 0; rank < n_pieces; rank++) {
+    out << "<Piece Source=\"" << vtu_piece_path(path, rank).filename().string() << "\"/>\n";
+  }
+  out << "</PUnstructuredGrid>\n</VTKFile>\n";
+  if (!out) throw std::runtime_error("Could not write " + path.string());
+}
+
+}  // namespace oiseau::io
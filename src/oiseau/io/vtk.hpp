@@ -0,0 +1,70 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <limits>
+#include <span>
+#include <string>
+#include <xtensor/containers/xarray.hpp>
+
+#include "oiseau/dg/dg_space.hpp"
+#include "oiseau/dg/nodal/ref_element.hpp"
+
+namespace oiseau::io::detail {
+
+/**
+ * @brief Equispaced reference points of a VTK Lagrange cell of `order`, in VTK point order.
+ *
+ * Vertices come first, then the points of each edge, then the interior ones; interior points of
+ * a triangle form a smaller triangle ordered the same way. Returns an np x dim array on the
+ * reference element of `type`.
+ */
+xt::xarray<double> vtk_lagrange_points(dg::nodal::RefElementType type, unsigned order);
+
+}  // namespace oiseau::io::detail
+
+namespace oiseau::io {
+
+/**
+ * @brief Nodal field written as VTK point data.
+ *
+ * `values` holds `n_components` blocks of `space.n_dofs()` values, component after component.
+ */
+struct VTKField {
+  std::string name;
+  std::span<const double> values;
+  unsigned n_components = 1;
+};
+
+/**
+ * @brief Writes the first `n_cells` elements of `space` and `fields` to a .vtu file.
+ *
+ * Each element gets its own points, so fields stay discontinuous across faces. Elements of
+ * order > 1 are written as VTK Lagrange cells, whose equispaced points are interpolated from
+ * the nodal values with one matrix product per (type, order) group. All arrays go in a single
+ * raw binary appended block, written with one call per array.
+ *
+ * Pass `n_owned_cells` of a `mesh::SubMesh` as `n_cells` to leave its ghost cells out.
+ */
+void vtu_write(const std::filesystem::path& path, const dg::DGSpace& space,
+               std::span<const VTKField> fields,
+               std::size_t n_cells = std::numeric_limits<std::size_t>::max());
+
+/// Path of the piece of `rank` referenced by the .pvtu file at `pvtu_path`.
+std::filesystem::path vtu_piece_path(const std::filesystem::path& pvtu_path, int rank);
+
+/**
+ * @brief Writes the .pvtu file gathering `n_pieces` pieces written at `vtu_piece_path`.
+ *
+ * Only the names and numbers of components of `fields` are used, so any rank may write it
+ * once every rank has written its own piece.
+ */
+void pvtu_write(const std::filesystem::path& path, int n_pieces, std::span<const VTKField> fields);
+
+}  // namespace oiseau::io
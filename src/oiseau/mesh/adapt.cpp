@@ -0,0 +1,418 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/mesh/adapt.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <span>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/refine.hpp"
+#include "oiseau/mesh/topology.hpp"
+
+namespace oiseau::mesh {
+
+namespace {
+
+constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+std::array<std::size_t, 2> edge_key(std::size_t a, std::size_t b) {
+  return a < b ? std::array{a, b} : std::array{b, a};
+}
+
+// for each child of a refined cell, the parent face each child face lies on, or -1 when the
+// child face is interior to the parent
+std::vector<std::vector<int>> make_child_faces(CellKind kind) {
+  const auto &rule = detail::refinement_rule(kind);
+  const int nv = static_cast<int>(rule.num_vertices);
+  std::vector<std::vector<int>> child_faces;
+  for (const auto &child : rule.children) {
+    std::vector<int> on_parent(rule.edges.size(), -1);
+    for (std::size_t g = 0; g < rule.edges.size(); g++) {
+      int u = child[rule.edges[g][0]];
+      int w = child[rule.edges[g][1]];
+      for (std::size_t f = 0; f < rule.edges.size(); f++) {
+        std::array<int, 3> nodes = {rule.edges[f][0], rule.edges[f][1], nv + static_cast<int>(f)};
+        if (std::ranges::count(nodes, u) && std::ranges::count(nodes, w)) {
+          on_parent[g] = static_cast<int>(f);
+        }
+      }
+    }
+    child_faces.push_back(std::move(on_parent));
+  }
+  return child_faces;
+}
+
+const std::vector<std::vector<int>> &child_faces(CellKind kind) {
+  static const std::map<CellKind, std::vector<std::vector<int>>> tables = {
+      {CellKind::Triangle, make_child_faces(CellKind::Triangle)},
+      {CellKind::Quadrilateral, make_child_faces(CellKind::Quadrilateral)}};
+  return tables.at(kind);
+}
+
+}  // namespace
+
+AdaptiveMesh::AdaptiveMesh(Mesh &&mesh) : m_mesh(std::move(mesh)) {
+  auto &topology = m_mesh.topology();
+  const std::size_t n_cells = topology.n_cells();
+  for (auto type : topology.cell_types()) {
+    if (type->kind() != CellKind::Triangle && type->kind() != CellKind::Quadrilateral) {
+      throw std::invalid_argument("AdaptiveMesh supports triangles and quadrilaterals only");
+    }
+  }
+  if (topology.e_to_e().size() != n_cells) topology.calculate_connectivity();
+  m_level.assign(n_cells, 0);
+  m_parent.assign(n_cells, NONE);
+  m_child_index.assign(n_cells, -1);
+}
+
+AdaptChange AdaptiveMesh::refine(std::span<const std::size_t> marked) {
+  const auto &topology = m_mesh.topology();
+  const std::size_t n_cells = topology.n_cells();
+  auto e_to_e = topology.e_to_e();
+
+  // closure: a refined cell drags along every coarser neighbour, so levels never differ by two
+  std::vector<Action> actions(n_cells, Action::Keep);
+  std::vector<std::size_t> work(marked.begin(), marked.end());
+  while (!work.empty()) {
+    std::size_t c = work.back();
+    work.pop_back();
+    if (c >= n_cells) throw std::out_of_range("Marked cell index out of range");
+    if (actions[c] == Action::Refine) continue;
+    actions[c] = Action::Refine;
+    for (auto k : e_to_e[c]) {
+      if (k != c && m_level[k] < m_level[c]) work.push_back(k);
+    }
+  }
+  return apply(actions);
+}
+
+AdaptChange AdaptiveMesh::coarsen(std::span<const std::size_t> marked) {
+  const auto &topology = m_mesh.topology();
+  const std::size_t n_cells = topology.n_cells();
+  auto e_to_e = topology.e_to_e();
+
+  std::vector<char> is_marked(n_cells, 0);
+  for (auto c : marked) {
+    if (c >= n_cells) throw std::out_of_range("Marked cell index out of range");
+    is_marked[c] = 1;
+  }
+
+  // a group merges when all its children are marked and none of them has a finer neighbour
+  std::unordered_map<std::size_t, std::size_t> n_marked;
+  std::unordered_set<std::size_t> blocked;
+  for (std::size_t c = 0; c < n_cells; c++) {
+    if (!is_marked[c] || m_parent[c] == NONE) continue;
+    n_marked[m_parent[c]]++;
+    for (auto k : e_to_e[c]) {
+      if (m_level[k] > m_level[c]) blocked.insert(m_parent[c]);
+    }
+  }
+
+  std::vector<Action> actions(n_cells, Action::Keep);
+  for (std::size_t c = 0; c < n_cells; c++) {
+    if (!is_marked[c] || m_parent[c] == NONE) continue;
+    const auto &record = m_parents[m_parent[c]];
+    const auto &rule = detail::refinement_rule(record.type->kind());
+    if (n_marked[m_parent[c]] == rule.children.size() && !blocked.contains(m_parent[c])) {
+      actions[c] = Action::Coarsen;
+    }
+  }
+  return apply(actions);
+}
+
+std::size_t AdaptiveMesh::midpoint(std::size_t a, std::size_t b, std::vector<double> &x) {
+  const unsigned gdim = m_mesh.geometry().dim();
+  auto key = edge_key(a, b);
+  auto [it, inserted] = m_edge_midpoints.try_emplace(key, x.size() / gdim);
+  if (inserted) {
+    for (unsigned d = 0; d < gdim; d++) x.push_back(0.5 * (x[a * gdim + d] + x[b * gdim + d]));
+    m_midpoint_edges.emplace(it->second, key);
+  }
+  return it->second;
+}
+
+std::size_t AdaptiveMesh::center(const std::vector<std::size_t> &vertices,
+                                 std::vector<double> &x) {
+  const unsigned gdim = m_mesh.geometry().dim();
+  QuadKey key;
+  std::ranges::copy(vertices, key.begin());
+  std::ranges::sort(key);
+  auto [it, inserted] = m_cell_centers.try_emplace(key, x.size() / gdim);
+  if (inserted) {
+    for (unsigned d = 0; d < gdim; d++) {
+      double sum = 0.0;
+      for (auto v : vertices) sum += x[v * gdim + d];
+      x.push_back(sum / vertices.size());
+    }
+  }
+  return it->second;
+}
+
+AdaptChange AdaptiveMesh::apply(const std::vector<Action> &actions) {
+  const auto &old_topology = m_mesh.topology();
+  const std::size_t n_old = old_topology.n_cells();
+  const unsigned gdim = m_mesh.geometry().dim();
+  auto old_conn = old_topology.conn();
+  auto old_types = old_topology.cell_types();
+  auto old_tags = old_topology.cell_tags();
+  auto old_e_to_e = old_topology.e_to_e();
+  auto old_e_to_f = old_topology.e_to_f();
+  auto old_facet_tags = old_topology.facet_tags();
+  auto old_x = m_mesh.geometry().x();
+  std::vector<double> x(old_x.begin(), old_x.end());
+
+  std::unordered_map<std::size_t, std::vector<std::size_t>> groups;
+  for (std::size_t c = 0; c < n_old; c++) {
+    if (actions[c] != Action::Coarsen) continue;
+    auto &group = groups[m_parent[c]];
+    group.resize(detail::refinement_rule(old_types[c]->kind()).children.size());
+    group[m_child_index[c]] = c;
+  }
+
+  // new cells, in the order of the old cells they come from
+  std::vector<std::vector<std::size_t>> conn;
+  std::vector<CellType> types;
+  std::vector<int> tags;
+  std::vector<unsigned> level;
+  std::vector<std::size_t> parent;
+  std::vector<int> child_index;
+  std::vector<std::vector<int>> facet_tags;
+  std::vector<std::size_t> old_to_new(n_old, NONE);
+  AdaptChange change;
+  auto emit = [&](std::vector<std::size_t> &&cell, CellType type, int tag, unsigned lvl,
+                  std::size_t p, int k, std::vector<int> &&cell_facet_tags, CellOrigin origin,
+                  std::vector<std::size_t> &&sources, int source_child) {
+    conn.push_back(std::move(cell));
+    types.push_back(type);
+    tags.push_back(tag);
+    level.push_back(lvl);
+    parent.push_back(p);
+    child_index.push_back(k);
+    facet_tags.push_back(std::move(cell_facet_tags));
+    change.origin.push_back(origin);
+    change.sources.push_back(std::move(sources));
+    change.child_index.push_back(source_child);
+  };
+
+  for (std::size_t c = 0; c < n_old; c++) {
+    switch (actions[c]) {
+    case Action::Keep:
+      old_to_new[c] = conn.size();
+      emit({old_conn[c].begin(), old_conn[c].end()}, old_types[c], old_tags[c], m_level[c],
+           m_parent[c], m_child_index[c], std::vector<int>(old_facet_tags[c]), CellOrigin::Kept,
+           {c}, -1);
+      break;
+    case Action::Refine: {
+      const auto kind = old_types[c]->kind();
+      const auto &rule = detail::refinement_rule(kind);
+      const auto &on_parent = child_faces(kind);
+      std::size_t record = m_parents.size();
+      if (!m_free_parents.empty()) {
+        record = m_free_parents.back();
+        m_free_parents.pop_back();
+      } else {
+        m_parents.emplace_back();
+      }
+      m_parents[record] = {old_conn[c],         old_types[c],     old_tags[c],
+                           m_level[c],          m_parent[c],      m_child_index[c],
+                           old_facet_tags[c]};
+
+      std::vector<std::size_t> local(old_conn[c].begin(), old_conn[c].end());
+      for (const auto &edge : rule.edges) {
+        local.push_back(midpoint(old_conn[c][edge[0]], old_conn[c][edge[1]], x));
+      }
+      if (rule.center_node) local.push_back(center(old_conn[c], x));
+
+      for (std::size_t k = 0; k < rule.children.size(); k++) {
+        std::vector<std::size_t> child;
+        for (auto v : rule.children[k]) child.push_back(local[v]);
+        std::vector<int> child_facet_tags(on_parent[k].size(), UNTAGGED);
+        for (std::size_t g = 0; g < on_parent[k].size(); g++) {
+          if (on_parent[k][g] >= 0) child_facet_tags[g] = old_facet_tags[c][on_parent[k][g]];
+        }
+        emit(std::move(child), old_types[c], old_tags[c], m_level[c] + 1, record,
+             static_cast<int>(k), std::move(child_facet_tags), CellOrigin::Refined, {c},
+             static_cast<int>(k));
+      }
+      break;
+    }
+    case Action::Coarsen: {
+      auto it = groups.find(m_parent[c]);
+      if (it == groups.end()) break;
+      auto &record = m_parents[it->first];
+      emit(std::move(record.conn), record.type, record.tag, record.level, record.parent,
+           record.child_index, std::move(record.facet_tags), CellOrigin::Coarsened,
+           std::move(it->second), -1);
+      m_free_parents.push_back(it->first);
+      groups.erase(it);
+      break;
+    }
+    }
+  }
+  const std::size_t n_new = conn.size();
+
+  // region whose faces are resolved again: new cells and the kept cells touching them
+  std::vector<char> in_region(n_new, 0);
+  for (std::size_t i = 0; i < n_new; i++) in_region[i] = change.origin[i] != CellOrigin::Kept;
+  auto touch = [&](std::size_t c) {
+    if (actions[c] == Action::Keep) in_region[old_to_new[c]] = 1;
+  };
+  for (std::size_t c = 0; c < n_old; c++) {
+    if (actions[c] == Action::Keep) continue;
+    for (auto k : old_e_to_e[c]) touch(k);
+  }
+  for (const auto &face : m_nonconforming) {
+    std::array<std::size_t, 3> cells = {face.coarse_cell, face.fine_cells[0], face.fine_cells[1]};
+    if (std::ranges::any_of(cells, [&](std::size_t c) { return actions[c] != Action::Keep; })) {
+      for (auto c : cells) touch(c);
+    }
+  }
+
+  // faces of the region and of its kept neighbours, by sorted vertex pair
+  std::vector<char> in_map(in_region);
+  for (std::size_t c = 0; c < n_old; c++) {
+    if (actions[c] != Action::Keep || !in_region[old_to_new[c]]) continue;
+    for (auto k : old_e_to_e[c]) {
+      if (actions[k] == Action::Keep) in_map[old_to_new[k]] = 1;
+    }
+  }
+  for (const auto &face : m_nonconforming) {
+    if (actions[face.coarse_cell] != Action::Keep) continue;
+    if (!in_region[old_to_new[face.coarse_cell]]) continue;
+    for (auto c : face.fine_cells) {
+      if (actions[c] == Action::Keep) in_map[old_to_new[c]] = 1;
+    }
+  }
+  std::unordered_map<EdgeKey, std::vector<std::pair<std::size_t, std::size_t>>, KeyHash> faces;
+  for (std::size_t i = 0; i < n_new; i++) {
+    if (!in_map[i]) continue;
+    const auto &edges = detail::refinement_rule(types[i]->kind()).edges;
+    for (std::size_t f = 0; f < edges.size(); f++) {
+      faces[edge_key(conn[i][edges[f][0]], conn[i][edges[f][1]])].emplace_back(i, f);
+    }
+  }
+  auto owner = [&](std::size_t a, std::size_t b) -> const std::pair<std::size_t, std::size_t> * {
+    auto it = faces.find(edge_key(a, b));
+    return it == faces.end() ? nullptr : &it->second.front();
+  };
+
+  std::vector<std::vector<std::size_t>> e_to_e(n_new);
+  std::vector<std::vector<std::size_t>> e_to_f(n_new);
+  std::vector<NonConformingFace> nonconforming;
+  for (std::size_t i = 0; i < n_new; i++) {
+    if (in_region[i]) continue;
+    const std::size_t c = change.sources[i].front();
+    e_to_e[i].resize(old_e_to_e[c].size());
+    for (std::size_t f = 0; f < old_e_to_e[c].size(); f++) {
+      e_to_e[i][f] = old_to_new[old_e_to_e[c][f]];
+    }
+    e_to_f[i].assign(old_e_to_f[c].begin(), old_e_to_f[c].end());
+  }
+  for (auto face : m_nonconforming) {
+    if (actions[face.coarse_cell] != Action::Keep) continue;
+    if (in_region[old_to_new[face.coarse_cell]]) continue;
+    face.coarse_cell = old_to_new[face.coarse_cell];
+    for (auto &c : face.fine_cells) c = old_to_new[c];
+    nonconforming.push_back(face);
+  }
+
+  for (std::size_t i = 0; i < n_new; i++) {
+    if (!in_region[i]) continue;
+    const auto &edges = detail::refinement_rule(types[i]->kind()).edges;
+    e_to_e[i].assign(edges.size(), i);
+    e_to_f[i].resize(edges.size());
+    for (std::size_t f = 0; f < edges.size(); f++) {
+      e_to_f[i][f] = f;
+      const std::size_t a = conn[i][edges[f][0]];
+      const std::size_t b = conn[i][edges[f][1]];
+
+      // conforming: another cell has the same face
+      const auto &same = faces.at(edge_key(a, b));
+      auto other = std::ranges::find_if(same, [i](const auto &o) { return o.first != i; });
+      if (other != same.end()) {
+        e_to_e[i][f] = other->first;
+        e_to_f[i][f] = other->second;
+        continue;
+      }
+
+      // coarse side: both halves of the face belong to finer cells
+      auto mid = m_edge_midpoints.find(edge_key(a, b));
+      if (mid != m_edge_midpoints.end()) {
+        const std::size_t m = mid->second;
+        const auto *half0 = owner(a, m);
+        const auto *half1 = owner(m, b);
+        if (half0 && half1) {
+          e_to_e[i][f] = half0->first;
+          e_to_f[i][f] = half0->second;
+          auto first_vertex = [&](const std::pair<std::size_t, std::size_t> &h) {
+            const auto &fine_edges = detail::refinement_rule(types[h.first]->kind()).edges;
+            return conn[h.first][fine_edges[h.second][0]];
+          };
+          nonconforming.push_back({i,
+                                   f,
+                                   {half0->first, half1->first},
+                                   {half0->second, half1->second},
+                                   {first_vertex(*half0) != a, first_vertex(*half1) != m}});
+          continue;
+        }
+      }
+
+      // fine side: one endpoint splits a coarser face that ends at the other endpoint
+      for (auto [m, v] : {std::pair{a, b}, std::pair{b, a}}) {
+        auto split = m_midpoint_edges.find(m);
+        if (split == m_midpoint_edges.end()) continue;
+        const auto [p, q] = split->second;
+        if (v != p && v != q) continue;
+        if (const auto *coarse = owner(p, q)) {
+          e_to_e[i][f] = coarse->first;
+          e_to_f[i][f] = coarse->second;
+          break;
+        }
+      }
+    }
+  }
+
+  // tagged facets are listed once: from the fine side of non-conforming faces, and from the
+  // lower-numbered cell of conforming ones
+  std::vector<std::vector<std::size_t>> boundary_facets;
+  std::vector<int> boundary_facet_tags;
+  for (std::size_t i = 0; i < n_new; i++) {
+    const auto &edges = detail::refinement_rule(types[i]->kind()).edges;
+    for (std::size_t f = 0; f < edges.size(); f++) {
+      if (facet_tags[i][f] == UNTAGGED) continue;
+      const std::size_t k = e_to_e[i][f];
+      if (k == i || level[k] < level[i] || (level[k] == level[i] && i < k)) {
+        boundary_facets.push_back({conn[i][edges[f][0]], conn[i][edges[f][1]]});
+        boundary_facet_tags.push_back(facet_tags[i][f]);
+      }
+    }
+  }
+
+  Topology topology(std::move(conn), std::move(types), std::move(tags));
+  topology.set_boundary_facets(std::move(boundary_facets), std::move(boundary_facet_tags));
+  topology.set_physical_names(std::map(old_topology.physical_names()));
+  topology.set_connectivity(std::move(e_to_e), std::move(e_to_f), std::move(facet_tags));
+  m_mesh = Mesh(std::move(topology), Geometry(std::move(x), gdim));
+  m_level = std::move(level);
+  m_parent = std::move(parent);
+  m_child_index = std::move(child_index);
+  m_nonconforming = std::move(nonconforming);
+  return change;
+}
+
+}  // namespace oiseau::mesh
@@ -0,0 +1,107 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/utils/hash.hpp"
+
+namespace oiseau::mesh {
+
+/**
+ * @brief A face shared by one coarse cell and the two finer cells covering its halves.
+ *
+ * On the coarse side `e_to_e`/`e_to_f` point to `fine_cells[0]`; on the fine side they point to
+ * the coarse cell and face. Half 0 starts at the first vertex of the coarse face. Face nodes
+ * are assumed to run from the first to the second face vertex, so `reversed[h]` tells whether
+ * fine face h runs against the coarse face.
+ */
+struct NonConformingFace {
+  std::size_t coarse_cell;
+  std::size_t coarse_face;
+  std::array<std::size_t, 2> fine_cells;
+  std::array<std::size_t, 2> fine_faces;
+  std::array<bool, 2> reversed;
+};
+
+enum class CellOrigin : unsigned char { Kept, Refined, Coarsened };
+
+/**
+ * @brief Where each cell of the adapted mesh comes from, to carry cell data over.
+ *
+ * `sources[i]` is the old cell itself when kept, the old parent when refined (with
+ * `child_index[i]` telling which child), or the old children in child order when coarsened.
+ */
+struct AdaptChange {
+  std::vector<CellOrigin> origin;
+  std::vector<std::vector<std::size_t>> sources;
+  std::vector<int> child_index;
+};
+
+/**
+ * @brief Locally refined and coarsened 2D mesh of triangles and quadrilaterals.
+ *
+ * Marked cells split into four children sharing edge midpoints with their neighbours.
+ * Neighbouring cells differ by at most one level (2:1 balance), so every non-conforming face
+ * has one coarse and two fine sides, listed in `nonconforming_faces`. After each change the
+ * connectivity is only recomputed around the modified cells and relabelled elsewhere.
+ */
+class AdaptiveMesh {
+ public:
+  explicit AdaptiveMesh(Mesh &&mesh);
+
+  Mesh &mesh() { return m_mesh; }
+  const Mesh &mesh() const { return m_mesh; }
+  std::span<const unsigned> levels() const { return m_level; }
+  std::span<const NonConformingFace> nonconforming_faces() const { return m_nonconforming; }
+
+  /// Refines the marked cells, plus any coarser neighbours needed to keep the 2:1 balance.
+  AdaptChange refine(std::span<const std::size_t> marked);
+
+  /// Merges sibling groups whose children are all marked, unless that breaks the 2:1 balance.
+  AdaptChange coarsen(std::span<const std::size_t> marked);
+
+ private:
+  enum class Action : unsigned char { Keep, Refine, Coarsen };
+
+  using EdgeKey = std::array<std::size_t, 2>;
+  using QuadKey = std::array<std::size_t, 4>;
+  using KeyHash = oiseau::utils::ArrayHash;
+
+  struct ParentRecord {
+    std::vector<std::size_t> conn;
+    CellType type;
+    int tag;
+    unsigned level;
+    std::size_t parent;
+    int child_index;
+    std::vector<int> facet_tags;
+  };
+
+  AdaptChange apply(const std::vector<Action> &actions);
+  std::size_t midpoint(std::size_t a, std::size_t b, std::vector<double> &x);
+  std::size_t center(const std::vector<std::size_t> &vertices, std::vector<double> &x);
+
+  Mesh m_mesh;
+  std::vector<unsigned> m_level;
+  std::vector<std::size_t> m_parent;
+  std::vector<int> m_child_index;
+  std::vector<ParentRecord> m_parents;
+  std::vector<std::size_t> m_free_parents;
+  std::vector<NonConformingFace> m_nonconforming;
+  // midpoint node of every split edge, and the edge each midpoint node splits
+  std::unordered_map<EdgeKey, std::size_t, KeyHash> m_edge_midpoints;
+  std::unordered_map<std::size_t, EdgeKey> m_midpoint_edges;
+  std::unordered_map<QuadKey, std::size_t, KeyHash> m_cell_centers;
+};
+
+}  // namespace oiseau::mesh
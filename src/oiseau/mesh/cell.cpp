@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -21,6 +22,9 @@ namespace oiseau::mesh {
 
 CellType get_cell_type(const CellKind cell_kind) {
   static std::unordered_map<CellKind, std::unique_ptr<Cell>> cache;
+  // recursive, since building a cell looks up its facet and edge types
+  static std::recursive_mutex mutex;
+  std::lock_guard lock(mutex);
 
   auto it = cache.find(cell_kind);
   if (it != cache.end()) {
@@ -212,35 +216,49 @@ HexahedronCell::HexahedronCell() {
   m_dim = 3;
 
   m_geometry = {
-      {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 0.0},
+      {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 1.0, 0.0,
+       0.0, 0.0, 1.0, 1.0, 0.0, 1.0, 1.0, 1.0, 1.0, 0.0, 1.0, 1.0},
       {8, 3},
   };
 
   m_topology = {
       {
-          {{0}, {0, 1, 2, 3}, {0}},
-          {{1}, {4, 5, 6, 7}, {0}},
-          {{2}, {0, 1, 5, 4}, {0}},
-          {{3}, {1, 2, 6, 5}, {0}},
-          {{4}, {2, 3, 7, 6}, {0}},
-          {{5}, {3, 0, 4, 7}, {0}},
+          {{0}, {0, 3, 8}, {0, 2, 5}, {0}},
+          {{1}, {0, 1, 9}, {0, 2, 3}, {0}},
+          {{2}, {1, 2, 10}, {0, 3, 4}, {0}},
+          {{3}, {2, 3, 11}, {0, 4, 5}, {0}},
+          {{4}, {4, 7, 8}, {1, 2, 5}, {0}},
+          {{5}, {4, 5, 9}, {1, 2, 3}, {0}},
+          {{6}, {5, 6, 10}, {1, 3, 4}, {0}},
+          {{7}, {6, 7, 11}, {1, 4, 5}, {0}},
       },
       {
-          {{0, 1}, {0, 1}, {0}},
-          {{1, 2}, {1, 2}, {0}},
-          {{2, 3}, {2, 3}, {0}},
-          {{3, 0}, {3, 0}, {0}},
-          {{4, 5}, {4, 5}, {0}},
-          {{5, 6}, {5, 6}, {0}},
-          {{6, 7}, {6, 7}, {0}},
-          {{7, 4}, {7, 4}, {0}},
-          {{0, 4}, {0, 4}, {0}},
-          {{1, 5}, {1, 5}, {0}},
-          {{2, 6}, {2, 6}, {0}},
-          {{3, 7}, {3, 7}, {0}},
+          {{0, 1}, {0}, {0, 2}, {0}},
+          {{1, 2}, {1}, {0, 3}, {0}},
+          {{2, 3}, {2}, {0, 4}, {0}},
+          {{3, 0}, {3}, {0, 5}, {0}},
+          {{4, 5}, {4}, {1, 2}, {0}},
+          {{5, 6}, {5}, {1, 3}, {0}},
+          {{6, 7}, {6}, {1, 4}, {0}},
+          {{7, 4}, {7}, {1, 5}, {0}},
+          {{0, 4}, {8}, {2, 5}, {0}},
+          {{1, 5}, {9}, {2, 3}, {0}},
+          {{2, 6}, {10}, {3, 4}, {0}},
+          {{3, 7}, {11}, {4, 5}, {0}},
+      },
+      {
+          {{0, 1, 2, 3}, {0, 1, 2, 3}, {0}, {0}},
+          {{4, 5, 6, 7}, {4, 5, 6, 7}, {1}, {0}},
+          {{0, 1, 5, 4}, {0, 4, 8, 9}, {2}, {0}},
+          {{1, 2, 6, 5}, {1, 5, 9, 10}, {3}, {0}},
+          {{2, 3, 7, 6}, {2, 6, 10, 11}, {4}, {0}},
+          {{3, 0, 4, 7}, {3, 7, 8, 11}, {5}, {0}},
       },
       {
-          {{0, 1, 2, 3, 4, 5, 6, 7}, {0, 1, 2, 3, 4, 5, 6, 7}, {0}},
+          {{0, 1, 2, 3, 4, 5, 6, 7},
+           {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11},
+           {0, 1, 2, 3, 4, 5},
+           {0}},
       },
   };
   m_facet = get_cell_type(CellKind::Quadrilateral);
@@ -6,6 +6,7 @@
 
 #include "oiseau/mesh/geometry.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <span>
 #include <utility>
@@ -16,6 +17,19 @@ using namespace oiseau::mesh;
 Geometry::Geometry() = default;
 Geometry::~Geometry() = default;
 std::span<double> Geometry::x() { return m_x; };
-std::span<double> Geometry::x_at(std::size_t pos) { return {&m_x[pos * m_dim], 3}; };
+std::span<const double> Geometry::x() const { return m_x; };
+std::span<double> Geometry::x_at(std::size_t pos) { return {&m_x[pos * m_dim], m_dim}; };
+std::span<const double> Geometry::x_at(std::size_t pos) const {
+  return {&m_x[pos * m_dim], m_dim};
+};
 Geometry::Geometry(std::vector<double> &&x, unsigned dim) : m_x(std::move(x)), m_dim(dim) {};
 unsigned Geometry::dim() const { return m_dim; };
+std::size_t Geometry::n_nodes() const { return m_dim ? m_x.size() / m_dim : 0; };
+
+void Geometry::permute_nodes(std::span<const std::size_t> new_to_old) {
+  std::vector<double> x(m_x.size());
+  for (std::size_t i = 0; i < new_to_old.size(); i++) {
+    std::copy_n(m_x.begin() + new_to_old[i] * m_dim, m_dim, x.begin() + i * m_dim);
+  }
+  m_x = std::move(x);
+};
@@ -21,8 +21,16 @@ class Geometry {
   ~Geometry();
 
   std::span<double> x();
+  std::span<const double> x() const;
   std::span<double> x_at(std::size_t pos);
+  std::span<const double> x_at(std::size_t pos) const;
   unsigned dim() const;
+  std::size_t n_nodes() const;
+
+  /**
+   * @brief Reorders the nodes so that new node i is the old node `new_to_old[i]`.
+   */
+  void permute_nodes(std::span<const std::size_t> new_to_old);
 
  private:
   std::vector<double> m_x;
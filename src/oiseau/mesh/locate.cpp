@@ -0,0 +1,322 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/mesh/locate.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/reorder.hpp"
+#include "oiseau/mesh/topology.hpp"
+
+namespace oiseau::mesh {
+
+namespace {
+
+constexpr std::size_t LEAF_SIZE = 4;
+constexpr int MAX_NEWTON_ITERATIONS = 20;
+constexpr double NEWTON_TOL = 1e-13;
+// a step this large means the point is far outside the cell
+constexpr double MAX_STEP = 1e3;
+constexpr std::uint32_t KEY_MAX = (1u << 21) - 1;
+
+using Vec = std::array<double, 3>;
+using Mat = std::array<Vec, 3>;
+
+// vertex positions of the tensor-product reference cells, in the order of the mesh cells
+constexpr std::array<Vec, 8> TENSOR_VERTICES = {{{-1.0, -1.0, -1.0},
+                                                 {1.0, -1.0, -1.0},
+                                                 {1.0, 1.0, -1.0},
+                                                 {-1.0, 1.0, -1.0},
+                                                 {-1.0, -1.0, 1.0},
+                                                 {1.0, -1.0, 1.0},
+                                                 {1.0, 1.0, 1.0},
+                                                 {-1.0, 1.0, 1.0}}};
+
+bool is_simplex(CellKind kind) {
+  return kind == CellKind::Interval || kind == CellKind::Triangle ||
+         kind == CellKind::Tetrahedron;
+}
+
+// vertex shape function i at xi and its gradient
+double shape(CellKind kind, std::size_t tdim, std::size_t i, const Vec &xi, Vec &grad) {
+  grad.fill(0.0);
+  if (is_simplex(kind)) {
+    if (i > 0) {
+      grad[i - 1] = 0.5;
+      return 0.5 * (1.0 + xi[i - 1]);
+    }
+    double sum = 1.0;
+    for (std::size_t d = 0; d < tdim; d++) {
+      grad[d] = -0.5;
+      sum -= 0.5 * (1.0 + xi[d]);
+    }
+    return sum;
+  }
+  const Vec &s = TENSOR_VERTICES[i];
+  double value = 1.0;
+  for (std::size_t d = 0; d < tdim; d++) {
+    double g = 0.5 * s[d];
+    for (std::size_t e = 0; e < tdim; e++) {
+      if (e != d) g *= 0.5 * (1.0 + s[e] * xi[e]);
+    }
+    grad[d] = g;
+    value *= 0.5 * (1.0 + s[d] * xi[d]);
+  }
+  return value;
+}
+
+// solves the n x n system a x = b in place by gaussian elimination with partial pivoting
+bool solve(Mat a, Vec &b, std::size_t n) {
+  for (std::size_t k = 0; k < n; k++) {
+    std::size_t p = k;
+    for (std::size_t i = k + 1; i < n; i++) {
+      if (std::abs(a[i][k]) > std::abs(a[p][k])) p = i;
+    }
+    if (a[p][k] == 0.0) return false;
+    std::swap(a[k], a[p]);
+    std::swap(b[k], b[p]);
+    for (std::size_t i = k + 1; i < n; i++) {
+      const double f = a[i][k] / a[k][k];
+      for (std::size_t j = k; j < n; j++) a[i][j] -= f * a[k][j];
+      b[i] -= f * b[k];
+    }
+  }
+  for (std::size_t k = n; k-- > 0;) {
+    for (std::size_t j = k + 1; j < n; j++) b[k] -= a[k][j] * b[j];
+    b[k] /= a[k][k];
+  }
+  return true;
+}
+
+}  // namespace
+
+PointLocator::PointLocator(const Mesh &mesh, double tol)
+    : m_mesh(&mesh), m_tol(tol), m_gdim(mesh.geometry().dim()) {
+  if (m_gdim == 0 || m_gdim > 3) throw std::invalid_argument("Geometry must be 1D, 2D or 3D");
+  const auto &topology = mesh.topology();
+  const auto &geometry = mesh.geometry();
+  const std::size_t n_cells = topology.n_cells();
+  auto conn = topology.conn();
+
+  std::vector<Box> cell_boxes(n_cells);
+#pragma omp parallel for
+  for (std::size_t i = 0; i < n_cells; i++) {
+    Box &box = cell_boxes[i];
+    box.lo.fill(0.0);
+    box.hi.fill(0.0);
+    for (std::size_t d = 0; d < m_gdim; d++) {
+      box.lo[d] = std::numeric_limits<double>::max();
+      box.hi[d] = std::numeric_limits<double>::lowest();
+    }
+    for (auto v : conn[i]) {
+      auto x = geometry.x_at(v);
+      for (std::size_t d = 0; d < m_gdim; d++) {
+        box.lo[d] = std::min(box.lo[d], x[d]);
+        box.hi[d] = std::max(box.hi[d], x[d]);
+      }
+    }
+  }
+
+  Box extent = {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+  if (n_cells > 0) extent = cell_boxes[0];
+  for (const auto &box : cell_boxes) {
+    for (std::size_t d = 0; d < 3; d++) {
+      extent.lo[d] = std::min(extent.lo[d], box.lo[d]);
+      extent.hi[d] = std::max(extent.hi[d], box.hi[d]);
+    }
+  }
+
+  // nearby cells land in the same leaves when sorted along a Morton curve
+  std::vector<std::uint64_t> keys(n_cells);
+#pragma omp parallel for
+  for (std::size_t i = 0; i < n_cells; i++) {
+    std::array<std::uint32_t, 3> q{0, 0, 0};
+    for (std::size_t d = 0; d < 3; d++) {
+      const double c = 0.5 * (cell_boxes[i].lo[d] + cell_boxes[i].hi[d]);
+      const double h = extent.hi[d] - extent.lo[d];
+      if (h > 0.0) q[d] = static_cast<std::uint32_t>((c - extent.lo[d]) / h * KEY_MAX);
+    }
+    keys[i] = morton_key(q[0], q[1], q[2]);
+  }
+  m_cells.resize(n_cells);
+  std::iota(m_cells.begin(), m_cells.end(), 0);
+  std::ranges::sort(m_cells, [&keys](std::size_t a, std::size_t b) {
+    return std::pair{keys[a], a} < std::pair{keys[b], b};
+  });
+  m_cell_boxes.resize(n_cells);
+  for (std::size_t k = 0; k < n_cells; k++) m_cell_boxes[k] = cell_boxes[m_cells[k]];
+
+  // complete binary tree: node k has children 2k + 1 and 2k + 2, leaves are the last level
+  m_n_leaves = std::bit_ceil(std::max<std::size_t>(1, (n_cells + LEAF_SIZE - 1) / LEAF_SIZE));
+  const Box empty = {{std::numeric_limits<double>::max(), std::numeric_limits<double>::max(),
+                      std::numeric_limits<double>::max()},
+                     {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(),
+                      std::numeric_limits<double>::lowest()}};
+  m_boxes.assign(2 * m_n_leaves - 1, empty);
+#pragma omp parallel for
+  for (std::size_t l = 0; l < m_n_leaves; l++) {
+    Box &box = m_boxes[m_n_leaves - 1 + l];
+    for (std::size_t k = l * LEAF_SIZE; k < std::min(n_cells, (l + 1) * LEAF_SIZE); k++) {
+      for (std::size_t d = 0; d < 3; d++) {
+        box.lo[d] = std::min(box.lo[d], m_cell_boxes[k].lo[d]);
+        box.hi[d] = std::max(box.hi[d], m_cell_boxes[k].hi[d]);
+      }
+    }
+  }
+  for (std::size_t width = m_n_leaves / 2; width > 0; width /= 2) {
+#pragma omp parallel for
+    for (std::size_t k = width - 1; k < 2 * width - 1; k++) {
+      for (std::size_t d = 0; d < 3; d++) {
+        m_boxes[k].lo[d] = std::min(m_boxes[2 * k + 1].lo[d], m_boxes[2 * k + 2].lo[d]);
+        m_boxes[k].hi[d] = std::max(m_boxes[2 * k + 1].hi[d], m_boxes[2 * k + 2].hi[d]);
+      }
+    }
+  }
+
+  double size = 0.0;
+  for (std::size_t d = 0; d < 3; d++) size = std::max(size, extent.hi[d] - extent.lo[d]);
+  m_pad = m_tol * size;
+}
+
+PointLocation PointLocator::locate_point(std::span<const double> x) const {
+  if (x.size() != m_gdim) throw std::invalid_argument("Point dimension does not match the mesh");
+  PointLocation location;
+  const std::size_t n_cells = m_cells.size();
+
+  std::array<std::size_t, 64> stack;
+  std::size_t top = 0;
+  stack[top++] = 0;
+  while (top > 0) {
+    const std::size_t k = stack[--top];
+    if (!contains(m_boxes[k], x)) continue;
+    if (k + 1 < m_n_leaves) {
+      stack[top++] = 2 * k + 2;
+      stack[top++] = 2 * k + 1;
+      continue;
+    }
+    const std::size_t l = k + 1 - m_n_leaves;
+    for (std::size_t i = l * LEAF_SIZE; i < std::min(n_cells, (l + 1) * LEAF_SIZE); i++) {
+      if (contains(m_cell_boxes[i], x) && inside(m_cells[i], x, location.ref)) {
+        location.cell = m_cells[i];
+        return location;
+      }
+    }
+  }
+  location.ref.fill(0.0);
+  return location;
+}
+
+std::vector<PointLocation> PointLocator::locate(std::span<const double> points) const {
+  if (points.size() % m_gdim != 0) {
+    throw std::invalid_argument("Point coordinates must be a multiple of the mesh dimension");
+  }
+  const std::size_t n_points = points.size() / m_gdim;
+  std::vector<PointLocation> locations(n_points);
+#pragma omp parallel for
+  for (std::size_t i = 0; i < n_points; i++) {
+    locations[i] = locate_point(points.subspan(i * m_gdim, m_gdim));
+  }
+  return locations;
+}
+
+bool PointLocator::contains(const Box &box, std::span<const double> x) const {
+  for (std::size_t d = 0; d < m_gdim; d++) {
+    if (x[d] < box.lo[d] - m_pad || x[d] > box.hi[d] + m_pad) return false;
+  }
+  return true;
+}
+
+bool PointLocator::inside(std::size_t cell, std::span<const double> x, Vec &ref) const {
+  const auto &topology = m_mesh->topology();
+  const auto &geometry = m_mesh->geometry();
+  const CellKind kind = topology.cell_types()[cell]->kind();
+  if (kind == CellKind::Undefined || kind == CellKind::Point) return false;
+  const auto tdim = static_cast<std::size_t>(topology.cell_types()[cell]->dimension());
+  const auto &vertices = topology.conn()[cell];
+
+  // start from the reference centroid
+  Vec xi = {0.0, 0.0, 0.0};
+  if (kind == CellKind::Triangle) xi = {-1.0 / 3.0, -1.0 / 3.0, 0.0};
+  if (kind == CellKind::Tetrahedron) xi = {-0.5, -0.5, -0.5};
+
+  // residual x - X(xi) and jacobian dX/dxi of the vertex map
+  Vec r;
+  Mat jac;
+  auto evaluate = [&]() {
+    Vec grad;
+    jac = {};
+    for (std::size_t d = 0; d < m_gdim; d++) r[d] = x[d];
+    for (std::size_t i = 0; i < vertices.size(); i++) {
+      const double n = shape(kind, tdim, i, xi, grad);
+      auto xv = geometry.x_at(vertices[i]);
+      for (std::size_t d = 0; d < m_gdim; d++) {
+        r[d] -= n * xv[d];
+        for (std::size_t e = 0; e < tdim; e++) jac[d][e] += grad[e] * xv[d];
+      }
+    }
+  };
+
+  // gauss-newton on |x - X(xi)|^2, exact in one step for simplices
+  double scale = 0.0;
+  for (int it = 0; it < MAX_NEWTON_ITERATIONS; it++) {
+    evaluate();
+    Mat jtj = {};
+    Vec delta = {0.0, 0.0, 0.0};
+    for (std::size_t e = 0; e < tdim; e++) {
+      for (std::size_t d = 0; d < m_gdim; d++) delta[e] += jac[d][e] * r[d];
+      for (std::size_t f = 0; f < tdim; f++) {
+        for (std::size_t d = 0; d < m_gdim; d++) jtj[e][f] += jac[d][e] * jac[d][f];
+      }
+    }
+    if (it == 0) {
+      for (std::size_t e = 0; e < tdim; e++) scale = std::max(scale, std::sqrt(jtj[e][e]));
+    }
+    if (!solve(jtj, delta, tdim)) return false;
+    double step = 0.0;
+    for (std::size_t e = 0; e < tdim; e++) {
+      xi[e] += delta[e];
+      step = std::max(step, std::abs(delta[e]));
+    }
+    if (step > MAX_STEP) return false;
+    if (step < NEWTON_TOL) break;
+  }
+  evaluate();
+
+  // the residual catches points off a lower-dimensional cell embedded in a higher dimension
+  double residual = 0.0;
+  for (std::size_t d = 0; d < m_gdim; d++) residual += r[d] * r[d];
+  if (std::sqrt(residual) > m_tol * scale) return false;
+  if (is_simplex(kind)) {
+    double sum = 0.0;
+    for (std::size_t d = 0; d < tdim; d++) {
+      if (xi[d] < -1.0 - m_tol) return false;
+      sum += 0.5 * (1.0 + xi[d]);
+    }
+    if (sum > 1.0 + m_tol) return false;
+  } else {
+    for (std::size_t d = 0; d < tdim; d++) {
+      if (std::abs(xi[d]) > 1.0 + m_tol) return false;
+    }
+  }
+  ref = xi;
+  return true;
+}
+
+}  // namespace oiseau::mesh
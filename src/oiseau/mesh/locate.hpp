@@ -0,0 +1,76 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "oiseau/mesh/mesh.hpp"
+
+namespace oiseau::mesh {
+
+/// Cell index reported for points that lie in no cell.
+inline constexpr std::size_t NOT_FOUND = std::numeric_limits<std::size_t>::max();
+
+/**
+ * @brief Cell containing a point and the point's coordinates on that cell's reference element.
+ *
+ * Reference cells span [-1, 1] per axis, with the vertex layout of the nodal reference elements.
+ * Unused reference coordinates are zero.
+ */
+struct PointLocation {
+  std::size_t cell = NOT_FOUND;
+  std::array<double, 3> ref = {0.0, 0.0, 0.0};
+};
+
+/**
+ * @brief Bounding volume hierarchy over the cells of a mesh for batched point location.
+ *
+ * Cells are sorted along a Morton curve through their centroids and grouped into leaves of a
+ * complete binary tree, so the tree is implicit and its boxes are built level by level in
+ * parallel. A query descends the boxes containing the point, O(log N) for reasonable meshes,
+ * and inverts the vertex map of the candidate cells by Newton's method.
+ *
+ * The locator keeps a pointer to `mesh`, which must outlive it and not change.
+ */
+class PointLocator {
+ public:
+  /**
+   * @param mesh mesh of linear cells (vertices only)
+   * @param tol relative tolerance on the reference coordinates for points on cell boundaries
+   */
+  explicit PointLocator(const Mesh &mesh, double tol = 1e-10);
+
+  /// Locates one point given by its `gdim` coordinates.
+  PointLocation locate_point(std::span<const double> x) const;
+
+  /// Locates `points.size() / gdim` points packed point after point, in parallel.
+  std::vector<PointLocation> locate(std::span<const double> points) const;
+
+ private:
+  struct Box {
+    std::array<double, 3> lo;
+    std::array<double, 3> hi;
+  };
+
+  bool contains(const Box &box, std::span<const double> x) const;
+  bool inside(std::size_t cell, std::span<const double> x, std::array<double, 3> &ref) const;
+
+  const Mesh *m_mesh;
+  double m_tol;
+  double m_pad = 0.0;
+  std::size_t m_gdim;
+  std::size_t m_n_leaves;
+  std::vector<std::size_t> m_cells;
+  std::vector<Box> m_cell_boxes;
+  std::vector<Box> m_boxes;
+};
+
+}  // namespace oiseau::mesh
@@ -0,0 +1,220 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/mesh/partition.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/reorder.hpp"
+#include "oiseau/mesh/topology.hpp"
+
+namespace oiseau::mesh {
+
+namespace {
+
+void check_connectivity(const Topology &topology) {
+  if (topology.e_to_e().size() != topology.n_cells()) {
+    throw std::runtime_error("Partitioning requires calculate_connectivity to be called first");
+  }
+}
+
+// Greedy boundary refinement: move a cell to the neighbouring part holding most of its faces
+// when that strictly lowers the edge cut and keeps both parts within the size bounds.
+void refine_partition(const Topology &topology, std::vector<int> &parts, int n_parts,
+                      std::size_t max_size, std::size_t min_size, int passes) {
+  auto e_to_e = topology.e_to_e();
+  std::vector<std::size_t> sizes(n_parts, 0);
+  for (auto p : parts) sizes[p]++;
+
+  std::vector<int> faces_in_part(n_parts, 0);
+  for (int pass = 0; pass < passes; pass++) {
+    std::size_t moves = 0;
+    for (std::size_t i = 0; i < parts.size(); i++) {
+      const int own = parts[i];
+      bool on_boundary = false;
+      for (auto k : e_to_e[i]) {
+        if (k == i) continue;
+        faces_in_part[parts[k]]++;
+        on_boundary = on_boundary || parts[k] != own;
+      }
+      if (on_boundary && sizes[own] > min_size) {
+        int best = own;
+        for (auto k : e_to_e[i]) {
+          int p = parts[k];
+          if (k == i || p == own || sizes[p] >= max_size) continue;
+          if (faces_in_part[p] > faces_in_part[best]) best = p;
+        }
+        if (best != own) {
+          parts[i] = best;
+          sizes[own]--;
+          sizes[best]++;
+          moves++;
+        }
+      }
+      for (auto k : e_to_e[i]) faces_in_part[parts[k]] = 0;
+      faces_in_part[own] = 0;
+    }
+    if (moves == 0) break;
+  }
+}
+
+}  // namespace
+
+std::vector<int> partition_cells(const Mesh &mesh, int n_parts, double tolerance,
+                                 int refine_passes) {
+  const auto &topology = mesh.topology();
+  const std::size_t n_cells = topology.n_cells();
+  if (n_parts < 1) throw std::invalid_argument("Number of parts must be positive");
+  check_connectivity(topology);
+
+  // contiguous chunks of the Hilbert curve are compact, well-balanced starting parts
+  auto order = space_filling_curve_ordering(mesh, ReorderMethod::Hilbert);
+  std::vector<int> parts(n_cells);
+  for (std::size_t k = 0; k < n_cells; k++) {
+    parts[order[k]] = static_cast<int>(k * n_parts / n_cells);
+  }
+  if (n_parts == 1 || n_cells == 0) return parts;
+
+  const double mean = static_cast<double>(n_cells) / n_parts;
+  const auto max_size = static_cast<std::size_t>(std::ceil(mean * (1.0 + tolerance)));
+  const auto min_size = static_cast<std::size_t>(std::floor(mean * (1.0 - tolerance)));
+  refine_partition(topology, parts, n_parts, max_size, min_size, refine_passes);
+  return parts;
+}
+
+PartitionQuality partition_quality(const Topology &topology, std::span<const int> parts,
+                                   int n_parts) {
+  check_connectivity(topology);
+  auto e_to_e = topology.e_to_e();
+  PartitionQuality quality;
+  quality.part_sizes.assign(n_parts, 0);
+  for (std::size_t i = 0; i < parts.size(); i++) {
+    quality.part_sizes[parts[i]]++;
+    for (auto k : e_to_e[i]) {
+      if (k > i && parts[k] != parts[i]) quality.edge_cut++;
+    }
+  }
+  const double mean = static_cast<double>(parts.size()) / n_parts;
+  const auto largest = *std::ranges::max_element(quality.part_sizes);
+  quality.imbalance = mean > 0.0 ? static_cast<double>(largest) / mean : 0.0;
+  return quality;
+}
+
+SubMesh extract_submesh(const Mesh &mesh, std::span<const int> parts, int rank,
+                        int ghost_layers) {
+  const auto &topology = mesh.topology();
+  const auto &geometry = mesh.geometry();
+  check_connectivity(topology);
+  const std::size_t n_cells = topology.n_cells();
+  auto e_to_e = topology.e_to_e();
+
+  SubMesh sub;
+  sub.rank = rank;
+  constexpr std::size_t unset = std::numeric_limits<std::size_t>::max();
+  std::vector<std::size_t> global_to_local(n_cells, unset);
+  for (std::size_t i = 0; i < n_cells; i++) {
+    if (parts[i] != rank) continue;
+    global_to_local[i] = sub.local_to_global_cells.size();
+    sub.local_to_global_cells.push_back(i);
+  }
+  sub.n_owned_cells = sub.local_to_global_cells.size();
+
+  // each ghost layer holds the face neighbours of the previous one, in increasing global order
+  std::size_t layer_begin = 0;
+  for (int layer = 0; layer < ghost_layers; layer++) {
+    std::size_t layer_end = sub.local_to_global_cells.size();
+    std::vector<std::size_t> next;
+    for (std::size_t l = layer_begin; l < layer_end; l++) {
+      for (auto k : e_to_e[sub.local_to_global_cells[l]]) {
+        if (global_to_local[k] != unset) continue;
+        global_to_local[k] = 0;
+        next.push_back(k);
+      }
+    }
+    std::ranges::sort(next);
+    for (auto k : next) {
+      global_to_local[k] = sub.local_to_global_cells.size();
+      sub.local_to_global_cells.push_back(k);
+      sub.ghost_owners.push_back(parts[k]);
+    }
+    layer_begin = layer_end;
+  }
+
+  const std::size_t n_local = sub.local_to_global_cells.size();
+  auto conn = topology.conn();
+  auto cell_types = topology.cell_types();
+  auto cell_tags = topology.cell_tags();
+  std::vector<std::size_t> node_to_local(geometry.n_nodes(), unset);
+  std::vector<std::vector<std::size_t>> local_conn(n_local);
+  std::vector<CellType> local_types(n_local);
+  std::vector<int> local_tags(n_local);
+  for (std::size_t l = 0; l < n_local; l++) {
+    std::size_t g = sub.local_to_global_cells[l];
+    local_types[l] = cell_types[g];
+    local_tags[l] = cell_tags[g];
+    local_conn[l].reserve(conn[g].size());
+    for (auto v : conn[g]) {
+      if (node_to_local[v] == unset) {
+        node_to_local[v] = sub.local_to_global_nodes.size();
+        sub.local_to_global_nodes.push_back(v);
+      }
+      local_conn[l].push_back(node_to_local[v]);
+    }
+  }
+
+  const unsigned gdim = geometry.dim();
+  auto x = geometry.x();
+  std::vector<double> local_x;
+  local_x.reserve(sub.local_to_global_nodes.size() * gdim);
+  for (auto v : sub.local_to_global_nodes) {
+    local_x.insert(local_x.end(), x.begin() + v * gdim, x.begin() + (v + 1) * gdim);
+  }
+
+  // keep the tagged facets lying entirely on local nodes
+  std::vector<std::vector<std::size_t>> local_facets;
+  std::vector<int> local_facet_tags;
+  auto facets = topology.boundary_facets();
+  auto facet_tags = topology.boundary_facet_tags();
+  for (std::size_t f = 0; f < facets.size(); f++) {
+    auto is_local = [&node_to_local](std::size_t v) { return node_to_local[v] != unset; };
+    if (!std::ranges::all_of(facets[f], is_local)) continue;
+    std::vector<std::size_t> facet;
+    for (auto v : facets[f]) facet.push_back(node_to_local[v]);
+    local_facets.push_back(std::move(facet));
+    local_facet_tags.push_back(facet_tags[f]);
+  }
+
+  Topology local_topology(std::move(local_conn), std::move(local_types), std::move(local_tags));
+  local_topology.set_boundary_facets(std::move(local_facets), std::move(local_facet_tags));
+  local_topology.set_physical_names(std::map(topology.physical_names()));
+  local_topology.calculate_connectivity();
+  sub.mesh = Mesh(std::move(local_topology), Geometry(std::move(local_x), gdim));
+  return sub;
+}
+
+std::vector<SubMesh> extract_submeshes(const Mesh &mesh, std::span<const int> parts, int n_parts,
+                                       int ghost_layers) {
+  std::vector<SubMesh> subs(n_parts);
+#pragma omp parallel for
+  for (int rank = 0; rank < n_parts; rank++) {
+    subs[rank] = extract_submesh(mesh, parts, rank, ghost_layers);
+  }
+  return subs;
+}
+
+}  // namespace oiseau::mesh
@@ -0,0 +1,68 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+
+namespace oiseau::mesh {
+
+/**
+ * @brief Edge cut and load balance of a cell partition.
+ *
+ * `edge_cut` counts the interior faces whose two cells belong to different parts and
+ * `imbalance` is the largest part size over the mean part size (1.0 is perfectly balanced).
+ */
+struct PartitionQuality {
+  std::size_t edge_cut = 0;
+  double imbalance = 0.0;
+  std::vector<std::size_t> part_sizes;
+};
+
+/**
+ * @brief Cells owned by one rank together with its ghost layers.
+ *
+ * Local cells are the owned cells, in increasing global order, followed by the ghost cells
+ * layer by layer. Connectivity of the sub-mesh is already computed.
+ */
+struct SubMesh {
+  int rank = 0;
+  Mesh mesh;
+  std::size_t n_owned_cells = 0;
+  std::vector<std::size_t> local_to_global_cells;
+  std::vector<std::size_t> local_to_global_nodes;
+  /// Owner rank of each ghost cell, indexed by `local cell - n_owned_cells`.
+  std::vector<int> ghost_owners;
+};
+
+/**
+ * @brief Splits the cells into `n_parts` parts along a Hilbert curve through the centroids,
+ * then moves boundary cells between parts to lower the edge cut.
+ *
+ * Refinement keeps every part within `(1 + tolerance)` of the mean size. Requires
+ * `calculate_connectivity` to have been called. Returns the part of each cell.
+ */
+std::vector<int> partition_cells(const Mesh &mesh, int n_parts, double tolerance = 0.05,
+                                 int refine_passes = 4);
+
+PartitionQuality partition_quality(const Topology &topology, std::span<const int> parts,
+                                   int n_parts);
+
+/**
+ * @brief Builds the sub-mesh of `rank` with `ghost_layers` layers of face-neighbour ghosts.
+ */
+SubMesh extract_submesh(const Mesh &mesh, std::span<const int> parts, int rank,
+                        int ghost_layers = 1);
+
+std::vector<SubMesh> extract_submeshes(const Mesh &mesh, std::span<const int> parts, int n_parts,
+                                       int ghost_layers = 1);
+
+}  // namespace oiseau::mesh
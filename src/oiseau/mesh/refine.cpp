@@ -0,0 +1,239 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/mesh/refine.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/utils/hash.hpp"
+
+namespace oiseau::mesh {
+
+namespace {
+
+using EdgeKey = std::array<std::size_t, 2>;
+using FaceKey = std::array<std::size_t, 4>;
+
+template <std::size_t N>
+std::array<std::size_t, N> sorted_key(const std::vector<int> &local,
+                                      const std::vector<std::size_t> &vertices) {
+  std::array<std::size_t, N> key;
+  for (std::size_t i = 0; i < N; i++) key[i] = vertices[local[i]];
+  std::ranges::sort(key);
+  return key;
+}
+
+CellKind facet_kind(std::size_t n_vertices) {
+  switch (n_vertices) {
+  case 1:
+    return CellKind::Point;
+  case 2:
+    return CellKind::Interval;
+  case 3:
+    return CellKind::Triangle;
+  case 4:
+    return CellKind::Quadrilateral;
+  default:
+    throw std::invalid_argument("Unsupported boundary facet with " + std::to_string(n_vertices) +
+                                " vertices");
+  }
+}
+
+detail::RefinementRule make_rule(CellKind kind, bool face_nodes, bool center_node,
+                                 std::vector<std::vector<int>> &&children) {
+  auto cell = get_cell_type(kind);
+  detail::RefinementRule rule;
+  rule.num_vertices = cell->num_sub_entities(0);
+  if (cell->dimension() >= 1) rule.edges = cell->get_entity_vertices(1);
+  if (face_nodes) rule.faces = cell->get_entity_vertices(2);
+  rule.center_node = center_node;
+  rule.children = std::move(children);
+  return rule;
+}
+
+}  // namespace
+
+namespace detail {
+
+const RefinementRule &refinement_rule(CellKind kind) {
+  // tetrahedra follow Bey (1995), with the last two vertices of two interior children swapped
+  // so that every child keeps the orientation of its parent
+  static const std::map<CellKind, RefinementRule> rules = [] {
+    std::map<CellKind, RefinementRule> r;
+    r.emplace(CellKind::Point, make_rule(CellKind::Point, false, false, {{0}}));
+    r.emplace(CellKind::Interval, make_rule(CellKind::Interval, false, false, {{0, 2}, {2, 1}}));
+    r.emplace(CellKind::Triangle, make_rule(CellKind::Triangle, false, false,
+                                            {{0, 5, 4}, {5, 1, 3}, {4, 3, 2}, {3, 4, 5}}));
+    r.emplace(CellKind::Quadrilateral,
+              make_rule(CellKind::Quadrilateral, false, true,
+                        {{0, 4, 8, 7}, {4, 1, 5, 8}, {7, 8, 6, 3}, {8, 5, 2, 6}}));
+    r.emplace(CellKind::Tetrahedron,
+              make_rule(CellKind::Tetrahedron, false, false,
+                        {{0, 9, 8, 7},
+                         {9, 1, 6, 5},
+                         {8, 6, 2, 4},
+                         {7, 5, 4, 3},
+                         {9, 8, 7, 5},
+                         {9, 8, 5, 6},
+                         {8, 7, 5, 4},
+                         {8, 6, 4, 5}}));
+    r.emplace(CellKind::Hexahedron, make_rule(CellKind::Hexahedron, true, true,
+                                              {{0, 8, 20, 11, 16, 22, 26, 25},
+                                               {8, 1, 9, 20, 22, 17, 23, 26},
+                                               {11, 20, 10, 3, 25, 26, 24, 19},
+                                               {20, 9, 2, 10, 26, 23, 18, 24},
+                                               {16, 22, 26, 25, 4, 12, 21, 15},
+                                               {22, 17, 23, 26, 12, 5, 13, 21},
+                                               {25, 26, 24, 19, 15, 21, 14, 7},
+                                               {26, 23, 18, 24, 21, 13, 6, 14}}));
+    return r;
+  }();
+  auto it = rules.find(kind);
+  if (it == rules.end()) throw std::invalid_argument("No refinement rule for this cell kind");
+  return it->second;
+}
+
+}  // namespace detail
+
+Mesh refine_uniform(const Mesh &mesh) {
+  const auto &topology = mesh.topology();
+  const auto &geometry = mesh.geometry();
+  const std::size_t n_cells = topology.n_cells();
+  const std::size_t n_nodes = geometry.n_nodes();
+  const unsigned gdim = geometry.dim();
+  auto conn = topology.conn();
+  auto cell_types = topology.cell_types();
+  auto cell_tags = topology.cell_tags();
+
+  std::vector<const detail::RefinementRule *> rules(n_cells);
+  std::vector<std::size_t> local_offsets(n_cells + 1, 0);
+  std::vector<std::size_t> child_offsets(n_cells + 1, 0);
+  for (std::size_t c = 0; c < n_cells; c++) {
+    rules[c] = &detail::refinement_rule(cell_types[c]->kind());
+    local_offsets[c + 1] = local_offsets[c] + rules[c]->num_local_nodes();
+    child_offsets[c + 1] = child_offsets[c] + rules[c]->children.size();
+  }
+
+  // global index of every local node of every cell; new nodes are numbered after the old ones
+  std::vector<std::size_t> local_nodes(local_offsets.back());
+#pragma omp parallel for
+  for (std::size_t c = 0; c < n_cells; c++) {
+    std::ranges::copy(conn[c], local_nodes.begin() + local_offsets[c]);
+  }
+
+  // new nodes are defined by their parents; their coordinates are the parents' average
+  std::vector<std::size_t> parent_offsets = {0};
+  std::vector<std::size_t> parents;
+  auto add_node = [&](auto &&vertices) {
+    parents.insert(parents.end(), vertices.begin(), vertices.end());
+    parent_offsets.push_back(parents.size());
+    return n_nodes + parent_offsets.size() - 2;
+  };
+
+  std::unordered_map<EdgeKey, std::size_t, oiseau::utils::ArrayHash> edge_nodes;
+  std::unordered_map<FaceKey, std::size_t, oiseau::utils::ArrayHash> face_nodes;
+  edge_nodes.reserve(n_cells * 2);
+  face_nodes.reserve(n_cells);
+  for (std::size_t c = 0; c < n_cells; c++) {
+    const auto &rule = *rules[c];
+    std::size_t k = local_offsets[c] + rule.num_vertices;
+    for (const auto &edge : rule.edges) {
+      auto key = sorted_key<2>(edge, conn[c]);
+      auto [it, inserted] = edge_nodes.try_emplace(key, 0);
+      if (inserted) it->second = add_node(key);
+      local_nodes[k++] = it->second;
+    }
+    for (const auto &face : rule.faces) {
+      auto key = sorted_key<4>(face, conn[c]);
+      auto [it, inserted] = face_nodes.try_emplace(key, 0);
+      if (inserted) it->second = add_node(key);
+      local_nodes[k++] = it->second;
+    }
+    if (rule.center_node) local_nodes[k++] = add_node(conn[c]);
+  }
+
+  const std::size_t n_new_nodes = parent_offsets.size() - 1;
+  auto x_old = geometry.x();
+  std::vector<double> x(x_old.begin(), x_old.end());
+  x.resize((n_nodes + n_new_nodes) * gdim, 0.0);
+#pragma omp parallel for
+  for (std::size_t i = 0; i < n_new_nodes; i++) {
+    double *xi = &x[(n_nodes + i) * gdim];
+    const std::size_t n_parents = parent_offsets[i + 1] - parent_offsets[i];
+    for (std::size_t p = parent_offsets[i]; p < parent_offsets[i + 1]; p++) {
+      for (unsigned d = 0; d < gdim; d++) xi[d] += x_old[parents[p] * gdim + d];
+    }
+    for (unsigned d = 0; d < gdim; d++) xi[d] /= n_parents;
+  }
+
+  const std::size_t n_children = child_offsets.back();
+  std::vector<std::vector<std::size_t>> children(n_children);
+  std::vector<CellType> child_types(n_children);
+  std::vector<int> child_tags(n_children);
+#pragma omp parallel for
+  for (std::size_t c = 0; c < n_cells; c++) {
+    const auto &rule = *rules[c];
+    const std::size_t *local = &local_nodes[local_offsets[c]];
+    for (std::size_t k = 0; k < rule.children.size(); k++) {
+      auto &child = children[child_offsets[c] + k];
+      child.reserve(rule.children[k].size());
+      for (auto v : rule.children[k]) child.push_back(local[v]);
+      child_types[child_offsets[c] + k] = cell_types[c];
+      child_tags[child_offsets[c] + k] = cell_tags[c];
+    }
+  }
+
+  // boundary facets reuse the edge and face nodes of the cells they lie on
+  std::vector<std::vector<std::size_t>> facets;
+  std::vector<int> facet_tags;
+  auto old_facets = topology.boundary_facets();
+  auto old_facet_tags = topology.boundary_facet_tags();
+  for (std::size_t f = 0; f < old_facets.size(); f++) {
+    const auto &vertices = old_facets[f];
+    const auto &rule = detail::refinement_rule(facet_kind(vertices.size()));
+    std::vector<std::size_t> local(vertices.begin(), vertices.end());
+    for (const auto &edge : rule.edges) {
+      auto it = edge_nodes.find(sorted_key<2>(edge, vertices));
+      if (it == edge_nodes.end()) {
+        throw std::runtime_error("Boundary facet does not lie on the cell edges");
+      }
+      local.push_back(it->second);
+    }
+    if (rule.center_node) {
+      auto it = face_nodes.find(sorted_key<4>({0, 1, 2, 3}, vertices));
+      if (it == face_nodes.end()) {
+        throw std::runtime_error("Boundary facet does not lie on the cell faces");
+      }
+      local.push_back(it->second);
+    }
+    for (const auto &child : rule.children) {
+      std::vector<std::size_t> facet;
+      for (auto v : child) facet.push_back(local[v]);
+      facets.push_back(std::move(facet));
+      facet_tags.push_back(old_facet_tags[f]);
+    }
+  }
+
+  Topology refined(std::move(children), std::move(child_types), std::move(child_tags));
+  refined.set_boundary_facets(std::move(facets), std::move(facet_tags));
+  refined.set_physical_names(std::map(topology.physical_names()));
+  return Mesh(std::move(refined), Geometry(std::move(x), gdim));
+}
+
+}  // namespace oiseau::mesh
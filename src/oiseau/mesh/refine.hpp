@@ -0,0 +1,55 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/mesh.hpp"
+
+namespace oiseau::mesh {
+
+/**
+ * @brief Splits every cell of `mesh` once, returning the refined mesh.
+ *
+ * Intervals are split in two; triangles and quadrilaterals in four; tetrahedra in eight
+ * following Bey's red refinement; hexahedra in eight. New nodes are placed at edge midpoints,
+ * quadrilateral face centres and quadrilateral/hexahedron centres, and are shared between
+ * neighbouring cells. Children of cell c are stored contiguously, in the order of c, and
+ * inherit its tag. Boundary facets are refined alongside. The old nodes keep their indices.
+ *
+ * Connectivity is not computed on the result.
+ */
+Mesh refine_uniform(const Mesh &mesh);
+
+namespace detail {
+
+/**
+ * @brief How a cell of a given kind splits into children.
+ *
+ * Local node layout of a refined cell: its vertices, one node per edge and, for hexahedra, one
+ * per face, all in the order of the `Cell` tables, then the centre node of quadrilaterals and
+ * hexahedra. `children` lists the vertices of each child in that local numbering.
+ */
+struct RefinementRule {
+  std::vector<std::vector<int>> edges;
+  std::vector<std::vector<int>> faces;
+  bool center_node;
+  std::vector<std::vector<int>> children;
+  std::size_t num_vertices;
+
+  std::size_t num_local_nodes() const {
+    return num_vertices + edges.size() + faces.size() + (center_node ? 1 : 0);
+  }
+};
+
+const RefinementRule &refinement_rule(CellKind kind);
+
+}  // namespace detail
+
+}  // namespace oiseau::mesh
@@ -0,0 +1,246 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/mesh/reorder.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+
+namespace oiseau::mesh {
+
+namespace {
+
+constexpr int KEY_BITS = 21;
+constexpr std::uint32_t KEY_MAX = (1u << KEY_BITS) - 1;
+
+// Skilling, "Programming the Hilbert curve" (2004): transposed Hilbert index, then interleaved.
+template <std::size_t N>
+std::uint64_t hilbert_index(std::array<std::uint32_t, N> x) {
+  const std::uint32_t m = 1u << (KEY_BITS - 1);
+  for (std::uint32_t q = m; q > 1; q >>= 1) {
+    const std::uint32_t p = q - 1;
+    for (std::size_t i = 0; i < N; i++) {
+      if (x[i] & q) {
+        x[0] ^= p;
+      } else {
+        const std::uint32_t t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+  for (std::size_t i = 1; i < N; i++) x[i] ^= x[i - 1];
+  std::uint32_t t = 0;
+  for (std::uint32_t q = m; q > 1; q >>= 1) {
+    if (x[N - 1] & q) t ^= q - 1;
+  }
+  for (std::size_t i = 0; i < N; i++) x[i] ^= t;
+
+  std::uint64_t key = 0;
+  for (int b = KEY_BITS - 1; b >= 0; b--) {
+    for (std::size_t i = 0; i < N; i++) key = (key << 1) | ((x[i] >> b) & 1u);
+  }
+  return key;
+}
+
+template <std::size_t N>
+std::uint64_t morton_index(const std::array<std::uint32_t, N> &x) {
+  std::uint64_t key = 0;
+  for (int b = KEY_BITS - 1; b >= 0; b--) {
+    for (std::size_t i = 0; i < N; i++) key = (key << 1) | ((x[i] >> b) & 1u);
+  }
+  return key;
+}
+
+// Breadth-first level structure rooted at `root`; returns the cells of the last level.
+std::vector<std::size_t> last_bfs_level(const Topology &topology, std::size_t root,
+                                        std::vector<std::size_t> &level) {
+  auto e_to_e = topology.e_to_e();
+  std::vector<std::size_t> frontier = {root};
+  std::vector<std::size_t> next;
+  std::fill(level.begin(), level.end(), std::numeric_limits<std::size_t>::max());
+  level[root] = 0;
+  while (true) {
+    next.clear();
+    for (auto i : frontier) {
+      for (auto k : e_to_e[i]) {
+        if (level[k] != std::numeric_limits<std::size_t>::max()) continue;
+        level[k] = level[i] + 1;
+        next.push_back(k);
+      }
+    }
+    if (next.empty()) return frontier;
+    std::swap(frontier, next);
+  }
+}
+
+std::size_t pseudo_peripheral_cell(const Topology &topology, std::size_t start,
+                                   const std::vector<std::size_t> &degree) {
+  std::vector<std::size_t> level(topology.n_cells());
+  std::size_t root = start;
+  std::size_t eccentricity = 0;
+  while (true) {
+    auto last = last_bfs_level(topology, root, level);
+    std::size_t candidate = *std::ranges::min_element(
+        last, [&degree](std::size_t a, std::size_t b) { return degree[a] < degree[b]; });
+    if (level[candidate] <= eccentricity) return root;
+    eccentricity = level[candidate];
+    root = candidate;
+  }
+}
+
+}  // namespace
+
+std::uint64_t hilbert_key(std::uint32_t x, std::uint32_t y, std::uint32_t z) {
+  return hilbert_index<3>({x & KEY_MAX, y & KEY_MAX, z & KEY_MAX});
+}
+
+std::uint64_t morton_key(std::uint32_t x, std::uint32_t y, std::uint32_t z) {
+  return morton_index<3>({x & KEY_MAX, y & KEY_MAX, z & KEY_MAX});
+}
+
+std::vector<std::size_t> rcm_ordering(const Topology &topology) {
+  const std::size_t n_cells = topology.n_cells();
+  auto e_to_e = topology.e_to_e();
+  if (e_to_e.size() != n_cells) {
+    throw std::runtime_error("rcm_ordering requires calculate_connectivity to be called first");
+  }
+
+  std::vector<std::size_t> degree(n_cells, 0);
+  for (std::size_t i = 0; i < n_cells; i++) {
+    degree[i] = std::ranges::count_if(e_to_e[i], [i](std::size_t k) { return k != i; });
+  }
+
+  std::vector<std::size_t> order;
+  order.reserve(n_cells);
+  std::vector<bool> visited(n_cells, false);
+  std::vector<std::size_t> neighbours;
+  for (std::size_t start = 0; start < n_cells; start++) {
+    if (visited[start]) continue;
+    std::size_t root = pseudo_peripheral_cell(topology, start, degree);
+    std::size_t head = order.size();
+    order.push_back(root);
+    visited[root] = true;
+    while (head < order.size()) {
+      std::size_t i = order[head++];
+      neighbours.clear();
+      for (auto k : e_to_e[i]) {
+        if (visited[k]) continue;
+        visited[k] = true;
+        neighbours.push_back(k);
+      }
+      std::ranges::sort(neighbours, [&degree](std::size_t a, std::size_t b) {
+        return std::pair{degree[a], a} < std::pair{degree[b], b};
+      });
+      order.insert(order.end(), neighbours.begin(), neighbours.end());
+    }
+  }
+  std::ranges::reverse(order);
+  return order;
+}
+
+std::vector<std::size_t> space_filling_curve_ordering(const Mesh &mesh, ReorderMethod method) {
+  const auto &topology = mesh.topology();
+  const auto &geometry = mesh.geometry();
+  const std::size_t n_cells = topology.n_cells();
+  const std::size_t gdim = std::min<std::size_t>(geometry.dim(), 3);
+  auto conn = topology.conn();
+
+  std::vector<std::array<double, 3>> centroids(n_cells, {0.0, 0.0, 0.0});
+#pragma omp parallel for
+  for (std::size_t i = 0; i < n_cells; i++) {
+    for (auto v : conn[i]) {
+      auto x = geometry.x_at(v);
+      for (std::size_t d = 0; d < gdim; d++) centroids[i][d] += x[d];
+    }
+    for (std::size_t d = 0; d < gdim; d++) centroids[i][d] /= conn[i].size();
+  }
+
+  std::array<double, 3> lo, hi;
+  lo.fill(std::numeric_limits<double>::max());
+  hi.fill(std::numeric_limits<double>::lowest());
+  for (const auto &c : centroids) {
+    for (std::size_t d = 0; d < 3; d++) {
+      lo[d] = std::min(lo[d], c[d]);
+      hi[d] = std::max(hi[d], c[d]);
+    }
+  }
+  // a flat mesh uses the 2D curve, otherwise the 3D curve would jump between z-slices
+  const bool planar = n_cells == 0 || hi[2] <= lo[2];
+
+  std::vector<std::uint64_t> keys(n_cells);
+#pragma omp parallel for
+  for (std::size_t i = 0; i < n_cells; i++) {
+    std::array<std::uint32_t, 3> q{0, 0, 0};
+    for (std::size_t d = 0; d < 3; d++) {
+      if (hi[d] > lo[d]) q[d] = static_cast<std::uint32_t>((centroids[i][d] - lo[d]) /
+                                                           (hi[d] - lo[d]) * KEY_MAX);
+    }
+    if (method == ReorderMethod::Hilbert) {
+      keys[i] = planar ? hilbert_index<2>({q[0], q[1]}) : hilbert_index<3>(q);
+    } else {
+      keys[i] = planar ? morton_index<2>({q[0], q[1]}) : morton_index<3>(q);
+    }
+  }
+
+  std::vector<std::size_t> order(n_cells);
+  std::iota(order.begin(), order.end(), 0);
+  std::ranges::sort(order, [&keys](std::size_t a, std::size_t b) {
+    return std::pair{keys[a], a} < std::pair{keys[b], b};
+  });
+  return order;
+}
+
+MeshPermutation reorder(Mesh &mesh, ReorderMethod method) {
+  auto &topology = mesh.topology();
+  auto &geometry = mesh.geometry();
+  const std::size_t n_cells = topology.n_cells();
+  if (topology.e_to_e().size() != n_cells) topology.calculate_connectivity();
+
+  MeshPermutation perm;
+  perm.cell_new_to_old = (method == ReorderMethod::ReverseCuthillMcKee)
+                             ? rcm_ordering(topology)
+                             : space_filling_curve_ordering(mesh, method);
+  perm.cell_old_to_new.resize(n_cells);
+  for (std::size_t i = 0; i < n_cells; i++) perm.cell_old_to_new[perm.cell_new_to_old[i]] = i;
+
+  // nodes are numbered by first use in the new cell order; unused nodes go last
+  const std::size_t n_nodes = geometry.n_nodes();
+  constexpr std::size_t unset = std::numeric_limits<std::size_t>::max();
+  perm.node_old_to_new.assign(n_nodes, unset);
+  perm.node_new_to_old.reserve(n_nodes);
+  auto conn = topology.conn();
+  for (auto c : perm.cell_new_to_old) {
+    for (auto v : conn[c]) {
+      if (perm.node_old_to_new[v] != unset) continue;
+      perm.node_old_to_new[v] = perm.node_new_to_old.size();
+      perm.node_new_to_old.push_back(v);
+    }
+  }
+  for (std::size_t v = 0; v < n_nodes; v++) {
+    if (perm.node_old_to_new[v] != unset) continue;
+    perm.node_old_to_new[v] = perm.node_new_to_old.size();
+    perm.node_new_to_old.push_back(v);
+  }
+
+  topology.permute_cells(perm.cell_new_to_old);
+  topology.renumber_vertices(perm.node_old_to_new);
+  geometry.permute_nodes(perm.node_new_to_old);
+  return perm;
+}
+
+}  // namespace oiseau::mesh
@@ -0,0 +1,63 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+
+namespace oiseau::mesh {
+
+enum class ReorderMethod { ReverseCuthillMcKee, Hilbert, Morton };
+
+/**
+ * @brief Cell and node permutations applied by `reorder`.
+ *
+ * `*_new_to_old[i]` is the old index of the new entity i and `*_old_to_new` is its inverse, so
+ * per-cell or per-node data can be carried over with `new_data[i] = old_data[new_to_old[i]]`.
+ */
+struct MeshPermutation {
+  std::vector<std::size_t> cell_new_to_old;
+  std::vector<std::size_t> cell_old_to_new;
+  std::vector<std::size_t> node_new_to_old;
+  std::vector<std::size_t> node_old_to_new;
+};
+
+/**
+ * @brief Reverse Cuthill–McKee ordering of the cell adjacency graph given by `e_to_e`.
+ *
+ * Each connected component starts from a pseudo-peripheral cell. Requires
+ * `calculate_connectivity` to have been called. Returns the new-to-old cell permutation.
+ */
+std::vector<std::size_t> rcm_ordering(const Topology &topology);
+
+/**
+ * @brief Orders the cells along a Hilbert or Morton curve through their centroids.
+ *
+ * Centroids are quantized to 21 bits per axis over the mesh bounding box. Returns the
+ * new-to-old cell permutation.
+ */
+std::vector<std::size_t> space_filling_curve_ordering(const Mesh &mesh, ReorderMethod method);
+
+/// Hilbert index of a point with 21-bit integer coordinates.
+std::uint64_t hilbert_key(std::uint32_t x, std::uint32_t y, std::uint32_t z);
+
+/// Morton (Z-order) index of a point with 21-bit integer coordinates.
+std::uint64_t morton_key(std::uint32_t x, std::uint32_t y, std::uint32_t z);
+
+/**
+ * @brief Reorders the cells of `mesh` with `method` and the nodes by first use in the new cell
+ * order, updating topology and geometry in place.
+ *
+ * Connectivity is computed if missing, since RCM needs it, and is kept consistent afterwards.
+ */
+MeshPermutation reorder(Mesh &mesh, ReorderMethod method);
+
+}  // namespace oiseau::mesh
@@ -7,72 +7,184 @@
 #include "oiseau/mesh/topology.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
+#include <limits>
+#include <map>
 #include <numeric>
 #include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <xtensor/containers/xadapt.hpp>
 
 #include "oiseau/mesh/cell.hpp"
+#include "oiseau/utils/hash.hpp"
 
 using namespace oiseau::mesh;
 
+namespace {
+
+// Sorted facet vertices, padded with max() so that lines, triangles and quads share one key type.
+using FacetKey = std::array<std::size_t, 4>;
+using FacetKeyHash = oiseau::utils::ArrayHash;
+
+template <typename Range>
+FacetKey make_facet_key(const Range& vertices) {
+  FacetKey key;
+  key.fill(std::numeric_limits<std::size_t>::max());
+  std::copy(vertices.begin(), vertices.end(), key.begin());
+  std::sort(key.begin(), key.begin() + vertices.size());
+  return key;
+}
+
+}  // namespace
+
 Topology::Topology() = default;
 Topology::~Topology() = default;
 
 Topology::Topology(std::vector<std::vector<std::size_t>>&& conn, std::vector<CellType>&& cell_types)
-    : m_conn(std::move(conn)), m_cell_types(std::move(cell_types)) {};
+    : m_conn(std::move(conn)),
+      m_cell_types(std::move(cell_types)),
+      m_cell_tags(m_conn.size(), UNTAGGED) {};
+
+Topology::Topology(std::vector<std::vector<std::size_t>>&& conn, std::vector<CellType>&& cell_types,
+                   std::vector<int>&& cell_tags)
+    : m_conn(std::move(conn)),
+      m_cell_types(std::move(cell_types)),
+      m_cell_tags(std::move(cell_tags)) {};
 
 std::span<CellType> Topology::cell_types() { return m_cell_types; };
+std::span<const CellType> Topology::cell_types() const { return m_cell_types; };
 
 std::span<std::vector<std::size_t>> Topology::conn() { return m_conn; };
+std::span<const std::vector<std::size_t>> Topology::conn() const { return m_conn; };
 std::span<std::vector<std::size_t>> Topology::e_to_e() { return m_e_to_e; };
+std::span<const std::vector<std::size_t>> Topology::e_to_e() const { return m_e_to_e; };
 std::span<std::vector<std::size_t>> Topology::e_to_f() { return m_e_to_f; };
+std::span<const std::vector<std::size_t>> Topology::e_to_f() const { return m_e_to_f; };
 
 std::size_t Topology::n_cells() const { return m_conn.size(); }
 
+std::span<int> Topology::cell_tags() { return m_cell_tags; };
+std::span<const int> Topology::cell_tags() const { return m_cell_tags; };
+
+void Topology::set_boundary_facets(std::vector<std::vector<std::size_t>>&& facets,
+                                   std::vector<int>&& facet_tags) {
+  m_boundary_facets = std::move(facets);
+  m_boundary_facet_tags = std::move(facet_tags);
+}
+
+std::span<const std::vector<std::size_t>> Topology::boundary_facets() const {
+  return m_boundary_facets;
+};
+std::span<const int> Topology::boundary_facet_tags() const { return m_boundary_facet_tags; };
+std::span<const std::vector<int>> Topology::facet_tags() const { return m_facet_tags; };
+
+void Topology::set_physical_names(std::map<std::pair<int, int>, std::string>&& names) {
+  m_physical_names = std::move(names);
+}
+
+const std::map<std::pair<int, int>, std::string>& Topology::physical_names() const {
+  return m_physical_names;
+}
+
 void Topology::calculate_connectivity() {
-  // this should be extended to 3d and for mixed cells squares/triangles
-  std::vector<std::vector<std::vector<std::size_t>>> faces;
-  for (std::size_t i = 0; i < m_conn.size(); i++) {
+  const std::size_t n_cells = m_conn.size();
+  m_e_to_e.resize(n_cells);
+  m_e_to_f.resize(n_cells);
+  m_facet_tags.resize(n_cells);
+
+  // tagged facets may lie on the boundary or on an interior interface between two regions
+  std::unordered_map<FacetKey, int, FacetKeyHash> tagged_facets;
+  tagged_facets.reserve(m_boundary_facets.size());
+  for (std::size_t k = 0; k < m_boundary_facets.size(); k++) {
+    tagged_facets.emplace(make_facet_key(m_boundary_facets[k]), m_boundary_facet_tags[k]);
+  }
+
+  // facets seen once so far; a second hit pairs the two cells and closes the facet
+  std::unordered_map<FacetKey, std::pair<std::size_t, std::size_t>, FacetKeyHash> open_facets;
+  open_facets.reserve(n_cells * 2);
+
+  for (std::size_t i = 0; i < n_cells; i++) {
     auto cell = m_cell_types[i];
-    if (cell->kind() != CellKind::Triangle) continue;
-    auto _conn = m_conn[i];
-
-    auto face_vertices = cell->get_entity_vertices(1);
-    std::vector<std::vector<std::size_t>> face(face_vertices.size());
-    for (std::size_t j = 0; j < face_vertices.size(); j++) {
-      face[j].resize(face_vertices[j].size());
-      for (std::size_t k = 0; k < face_vertices[j].size(); k++) {
-        face[j][k] = _conn[face_vertices[j][k]];
+    const auto& conn = m_conn[i];
+    std::vector<std::vector<int>> facet_vertices;
+    if (cell->dimension() > 0) facet_vertices = cell->get_entity_vertices(cell->dimension() - 1);
+
+    m_e_to_e[i].assign(facet_vertices.size(), i);
+    m_e_to_f[i].resize(facet_vertices.size());
+    std::iota(m_e_to_f[i].begin(), m_e_to_f[i].end(), 0);
+    m_facet_tags[i].assign(facet_vertices.size(), UNTAGGED);
+
+    for (std::size_t j = 0; j < facet_vertices.size(); j++) {
+      std::vector<std::size_t> vertices(facet_vertices[j].size());
+      std::ranges::transform(facet_vertices[j], vertices.begin(),
+                             [&conn](int idx) { return conn[idx]; });
+      auto key = make_facet_key(vertices);
+      if (!tagged_facets.empty()) {
+        auto tag_it = tagged_facets.find(key);
+        if (tag_it != tagged_facets.end()) m_facet_tags[i][j] = tag_it->second;
       }
-      std::sort(face[j].begin(), face[j].end());
+      auto [it, inserted] = open_facets.try_emplace(key, i, j);
+      if (inserted) continue;
+      auto [ii, jj] = it->second;
+      m_e_to_e[i][j] = ii;
+      m_e_to_e[ii][jj] = i;
+      m_e_to_f[i][j] = jj;
+      m_e_to_f[ii][jj] = j;
+      open_facets.erase(it);
     }
-    faces.push_back(std::move(face));
   }
-  m_e_to_e.resize(faces.size());
-  m_e_to_f.resize(faces.size());
-  for (std::size_t i = 0; i < m_e_to_e.size(); i++) {
-    m_e_to_e[i] = std::vector<std::size_t>(faces[i].size(), i);
-    m_e_to_f[i].resize(faces[i].size());
-    std::iota(m_e_to_f[i].begin(), m_e_to_f[i].end(), 0);
+}
+
+void Topology::set_connectivity(std::vector<std::vector<std::size_t>>&& e_to_e,
+                                std::vector<std::vector<std::size_t>>&& e_to_f,
+                                std::vector<std::vector<int>>&& facet_tags) {
+  if (e_to_e.size() != m_conn.size() || e_to_f.size() != m_conn.size() ||
+      facet_tags.size() != m_conn.size()) {
+    throw std::invalid_argument("Connectivity size does not match the number of cells");
   }
+  m_e_to_e = std::move(e_to_e);
+  m_e_to_f = std::move(e_to_f);
+  m_facet_tags = std::move(facet_tags);
+}
 
-  // TODO(tiagovla): this is not efficient, should use a hash map
-  for (std::size_t i = 0; i < faces.size(); i++) {
-    for (std::size_t j = 0; j < faces[i].size(); j++) {
-      for (std::size_t ii = i + 1; ii < faces.size(); ii++) {
-        for (std::size_t jj = 0; jj < faces[ii].size(); jj++) {
-          if (m_e_to_e[i][j] != i || m_e_to_e[ii][jj] != ii) continue;
-          if (faces[i][j] == faces[ii][jj]) {
-            m_e_to_e[i][j] = ii;
-            m_e_to_e[ii][jj] = i;
-            m_e_to_f[i][j] = jj;
-            m_e_to_f[ii][jj] = j;
-          }
-        }
-      }
+void Topology::permute_cells(std::span<const std::size_t> new_to_old) {
+  const std::size_t n_cells = m_conn.size();
+  if (new_to_old.size() != n_cells) {
+    throw std::invalid_argument("Cell permutation size does not match the number of cells");
+  }
+  std::vector<std::size_t> old_to_new(n_cells);
+  for (std::size_t i = 0; i < n_cells; i++) old_to_new[new_to_old[i]] = i;
+
+  auto permute = [&new_to_old](auto& values) {
+    if (values.empty()) return;
+    std::remove_reference_t<decltype(values)> permuted(values.size());
+    for (std::size_t i = 0; i < new_to_old.size(); i++) {
+      permuted[i] = std::move(values[new_to_old[i]]);
     }
+    values = std::move(permuted);
+  };
+  permute(m_conn);
+  permute(m_cell_types);
+  permute(m_cell_tags);
+  permute(m_e_to_f);
+  permute(m_facet_tags);
+  permute(m_e_to_e);
+  for (auto& neighbours : m_e_to_e) {
+    for (auto& k : neighbours) k = old_to_new[k];
+  }
+}
+
+void Topology::renumber_vertices(std::span<const std::size_t> old_to_new) {
+  for (auto& cell : m_conn) {
+    for (auto& v : cell) v = old_to_new[v];
+  }
+  for (auto& facet : m_boundary_facets) {
+    for (auto& v : facet) v = old_to_new[v];
   }
 }
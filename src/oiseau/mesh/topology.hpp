@@ -6,35 +6,104 @@
 
 #pragma once
 #include <cstddef>
+#include <map>
 #include <span>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "oiseau/mesh/cell.hpp"
 
 namespace oiseau::mesh {
 
+/// Tag value used for cells and facets that do not belong to any physical group.
+inline constexpr int UNTAGGED = -1;
+
 class Topology {
  public:
   Topology();
   Topology(std::vector<std::vector<std::size_t>> &&conn, std::vector<CellType> &&cell_types);
+  Topology(std::vector<std::vector<std::size_t>> &&conn, std::vector<CellType> &&cell_types,
+           std::vector<int> &&cell_tags);
   Topology(Topology &&) = default;
   Topology(const Topology &) = default;
   Topology &operator=(Topology &&) = default;
   Topology &operator=(const Topology &) = default;
   ~Topology();
   std::span<CellType> cell_types();
+  std::span<const CellType> cell_types() const;
   std::span<std::vector<std::size_t>> conn();
+  std::span<const std::vector<std::size_t>> conn() const;
   std::span<std::vector<std::size_t>> e_to_e();
+  std::span<const std::vector<std::size_t>> e_to_e() const;
   std::span<std::vector<std::size_t>> e_to_f();
+  std::span<const std::vector<std::size_t>> e_to_f() const;
   std::size_t n_cells() const;
   void calculate_connectivity();
 
+  /**
+   * @brief Installs connectivity computed elsewhere, e.g. updated incrementally by
+   * `AdaptiveMesh`, in place of `calculate_connectivity`.
+   */
+  void set_connectivity(std::vector<std::vector<std::size_t>> &&e_to_e,
+                        std::vector<std::vector<std::size_t>> &&e_to_f,
+                        std::vector<std::vector<int>> &&facet_tags);
+
+  /**
+   * @brief Reorders the cells so that new cell i is the old cell `new_to_old[i]`.
+   *
+   * Cell types, cell tags and, if already computed, `e_to_e`, `e_to_f` and `facet_tags` follow
+   * the cells; neighbour indices in `e_to_e` are renumbered accordingly.
+   */
+  void permute_cells(std::span<const std::size_t> new_to_old);
+
+  /**
+   * @brief Replaces every vertex index v in the cells and boundary facets by `old_to_new[v]`.
+   */
+  void renumber_vertices(std::span<const std::size_t> old_to_new);
+
+  /**
+   * @brief Physical tag of each cell, or UNTAGGED when the cell has none.
+   */
+  std::span<int> cell_tags();
+  std::span<const int> cell_tags() const;
+
+  /**
+   * @brief Stores the tagged lower-dimensional facets (e.g. lines of a 2D mesh).
+   *
+   * The facets are kept apart from the cells; `calculate_connectivity` matches them against the
+   * cell faces to fill `facet_tags`. Facets on interior interfaces tag both adjacent cells.
+   */
+  void set_boundary_facets(std::vector<std::vector<std::size_t>> &&facets,
+                           std::vector<int> &&facet_tags);
+  std::span<const std::vector<std::size_t>> boundary_facets() const;
+  std::span<const int> boundary_facet_tags() const;
+
+  /**
+   * @brief Physical tag of each local facet of each cell, indexed as `facet_tags()[cell][face]`.
+   *
+   * Available after `calculate_connectivity`. Facets without a matching tagged boundary facet
+   * are UNTAGGED.
+   */
+  std::span<const std::vector<int>> facet_tags() const;
+
+  /**
+   * @brief Names of the physical groups, keyed by (dimension, physical tag).
+   */
+  void set_physical_names(std::map<std::pair<int, int>, std::string> &&names);
+  const std::map<std::pair<int, int>, std::string> &physical_names() const;
+
  private:
   std::vector<std::vector<std::size_t>> m_conn;
   std::vector<std::vector<std::size_t>> m_e_to_v;
   std::vector<std::vector<std::size_t>> m_e_to_e;
   std::vector<std::vector<std::size_t>> m_e_to_f;
   std::vector<CellType> m_cell_types;
+  std::vector<int> m_cell_tags;
+  std::vector<std::vector<std::size_t>> m_boundary_facets;
+  std::vector<int> m_boundary_facet_tags;
+  std::vector<std::vector<int>> m_facet_tags;
+  std::map<std::pair<int, int>, std::string> m_physical_names;
 };
 
 }  // namespace oiseau::mesh
@@ -0,0 +1,135 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/parallel/halo.hpp"
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "oiseau/mesh/partition.hpp"
+#include "oiseau/parallel/transport.hpp"
+
+namespace oiseau::parallel {
+
+namespace {
+enum Tag : int { TAG_REQUEST_COUNT = 1, TAG_REQUEST_CELLS = 2, TAG_HALO = 3 };
+}  // namespace
+
+HaloExchange::HaloExchange(const mesh::SubMesh &sub, std::span<const std::size_t> cell_offsets,
+                           Transport &transport)
+    : m_transport(transport) {
+  const int n_ranks = transport.size();
+  const std::size_t n_owned = sub.n_owned_cells;
+  const std::size_t n_local = sub.local_to_global_cells.size();
+  if (cell_offsets.size() != n_local + 1) {
+    throw std::invalid_argument("cell_offsets must have one entry per local cell plus one");
+  }
+
+  // ghost cells grouped by owner, in local order; these are what we ask each owner for
+  std::vector<std::vector<std::size_t>> wanted(n_ranks);
+  std::vector<std::vector<std::size_t>> wanted_local(n_ranks);
+  for (std::size_t l = n_owned; l < n_local; l++) {
+    int owner = sub.ghost_owners[l - n_owned];
+    wanted[owner].push_back(sub.local_to_global_cells[l]);
+    wanted_local[owner].push_back(l);
+  }
+
+  // every rank tells every other rank, itself included, how many of its cells it needs; this
+  // count exchange is dense (one message per rank pair), only the cell lists below are sparse
+  std::vector<std::size_t> wanted_count(n_ranks), requested_count(n_ranks);
+  std::vector<Transport::Request> requests;
+  for (int r = 0; r < n_ranks; r++) {
+    wanted_count[r] = wanted[r].size();
+    requests.push_back(transport.irecv(r, TAG_REQUEST_COUNT, std::span(&requested_count[r], 1)));
+    requests.push_back(
+        transport.isend(r, TAG_REQUEST_COUNT, std::span<const std::size_t>(&wanted_count[r], 1)));
+  }
+  transport.wait_all(requests);
+  requests.clear();
+
+  std::vector<std::vector<std::size_t>> requested(n_ranks);
+  for (int r = 0; r < n_ranks; r++) {
+    requested[r].resize(requested_count[r]);
+    if (!requested[r].empty()) {
+      requests.push_back(transport.irecv(r, TAG_REQUEST_CELLS, std::span(requested[r])));
+    }
+    if (!wanted[r].empty()) {
+      requests.push_back(
+          transport.isend(r, TAG_REQUEST_CELLS, std::span<const std::size_t>(wanted[r])));
+    }
+  }
+  transport.wait_all(requests);
+
+  std::unordered_map<std::size_t, std::size_t> owned_local;
+  owned_local.reserve(n_owned);
+  for (std::size_t l = 0; l < n_owned; l++) owned_local.emplace(sub.local_to_global_cells[l], l);
+
+  m_send_offsets.push_back(0);
+  m_recv_offsets.push_back(0);
+  for (int r = 0; r < n_ranks; r++) {
+    if (!requested[r].empty()) {
+      for (auto g : requested[r]) {
+        auto it = owned_local.find(g);
+        if (it == owned_local.end()) {
+          throw std::runtime_error("Halo request for a cell not owned by this rank");
+        }
+        for (auto k = cell_offsets[it->second]; k < cell_offsets[it->second + 1]; k++) {
+          m_send_indices.push_back(k);
+        }
+      }
+      m_send_ranks.push_back(r);
+      m_send_offsets.push_back(m_send_indices.size());
+    }
+    if (!wanted_local[r].empty()) {
+      for (auto l : wanted_local[r]) {
+        for (auto k = cell_offsets[l]; k < cell_offsets[l + 1]; k++) m_recv_indices.push_back(k);
+      }
+      m_recv_ranks.push_back(r);
+      m_recv_offsets.push_back(m_recv_indices.size());
+    }
+  }
+  m_send_buffer.resize(m_send_indices.size());
+  m_recv_buffer.resize(m_recv_indices.size());
+
+  auto e_to_e = sub.mesh.topology().e_to_e();
+  for (std::size_t l = 0; l < n_owned; l++) {
+    bool interface = false;
+    for (auto k : e_to_e[l]) interface = interface || k >= n_owned;
+    (interface ? m_interface_cells : m_interior_cells).push_back(l);
+  }
+}
+
+void HaloExchange::begin(std::span<const double> u) {
+  m_requests.clear();
+  for (std::size_t k = 0; k < m_recv_ranks.size(); k++) {
+    auto buffer = std::span(m_recv_buffer)
+                      .subspan(m_recv_offsets[k], m_recv_offsets[k + 1] - m_recv_offsets[k]);
+    m_requests.push_back(m_transport.irecv(m_recv_ranks[k], TAG_HALO, buffer));
+  }
+
+  const std::size_t n_send = m_send_indices.size();
+#pragma omp parallel for
+  for (std::size_t i = 0; i < n_send; i++) m_send_buffer[i] = u[m_send_indices[i]];
+
+  for (std::size_t k = 0; k < m_send_ranks.size(); k++) {
+    auto buffer = std::span<const double>(m_send_buffer)
+                      .subspan(m_send_offsets[k], m_send_offsets[k + 1] - m_send_offsets[k]);
+    m_requests.push_back(m_transport.isend(m_send_ranks[k], TAG_HALO, buffer));
+  }
+}
+
+void HaloExchange::end(std::span<double> u) {
+  m_transport.wait_all(m_requests);
+  m_requests.clear();
+  const std::size_t n_recv = m_recv_indices.size();
+#pragma omp parallel for
+  for (std::size_t i = 0; i < n_recv; i++) u[m_recv_indices[i]] = m_recv_buffer[i];
+}
+
+}  // namespace oiseau::parallel
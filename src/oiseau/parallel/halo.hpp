@@ -0,0 +1,79 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "oiseau/mesh/partition.hpp"
+#include "oiseau/parallel/transport.hpp"
+
+namespace oiseau::parallel {
+
+/**
+ * @brief Exchanges the DOFs of ghost cells with their owner ranks.
+ *
+ * The DOFs of local cell l of the sub-mesh are `u[cell_offsets[l] .. cell_offsets[l + 1])`.
+ * Send and receive index lists are set up once; every exchange then packs into contiguous
+ * buffers. Construction is collective over all ranks of the transport and posts one count
+ * message per pair of ranks, so it costs O(size^2) messages in total.
+ *
+ * Whole ghost-cell blocks are shipped, not face traces: a triangle of order p sends
+ * (p + 1)(p + 2) / 2 values where the flux only needs p + 1 per shared face. Callers that only
+ * read face values can pass offsets of packed traces instead of cell DOFs.
+ *
+ * To overlap communication with computation, call `begin`, work on `interior_cells`, then
+ * call `end` before touching `interface_cells`:
+ *
+ * @code
+ * halo.begin(u);
+ * for (auto c : halo.interior_cells()) ...;
+ * halo.end(u);
+ * for (auto c : halo.interface_cells()) ...;
+ * @endcode
+ */
+class HaloExchange {
+ public:
+  HaloExchange(const mesh::SubMesh &sub, std::span<const std::size_t> cell_offsets,
+               Transport &transport);
+
+  /// Packs the owned DOFs requested by other ranks and posts all sends and receives.
+  void begin(std::span<const double> u);
+  /// Waits for the receives and writes the ghost DOFs into `u`.
+  void end(std::span<double> u);
+  void exchange(std::span<double> u) {
+    begin(u);
+    end(u);
+  }
+
+  /// Owned cells whose face neighbours are all owned.
+  std::span<const std::size_t> interior_cells() const { return m_interior_cells; }
+  /// Owned cells with at least one ghost face neighbour.
+  std::span<const std::size_t> interface_cells() const { return m_interface_cells; }
+  std::span<const int> send_ranks() const { return m_send_ranks; }
+  std::span<const int> recv_ranks() const { return m_recv_ranks; }
+  std::size_t send_size() const { return m_send_indices.size(); }
+  std::size_t recv_size() const { return m_recv_indices.size(); }
+
+ private:
+  Transport &m_transport;
+  std::vector<int> m_send_ranks;
+  std::vector<int> m_recv_ranks;
+  // DOF indices in packing order; rank k of m_send_ranks owns [m_send_offsets[k], [k + 1])
+  std::vector<std::size_t> m_send_offsets;
+  std::vector<std::size_t> m_send_indices;
+  std::vector<std::size_t> m_recv_offsets;
+  std::vector<std::size_t> m_recv_indices;
+  std::vector<double> m_send_buffer;
+  std::vector<double> m_recv_buffer;
+  std::vector<Transport::Request> m_requests;
+  std::vector<std::size_t> m_interior_cells;
+  std::vector<std::size_t> m_interface_cells;
+};
+
+}  // namespace oiseau::parallel
@@ -0,0 +1,124 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oiseau/parallel/transport.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace oiseau::parallel {
+
+namespace {
+constexpr Transport::Request COMPLETED = std::numeric_limits<Transport::Request>::max();
+}  // namespace
+
+SharedMemoryHub::SharedMemoryHub(int size) : m_size(size) {
+  if (size < 1) throw std::invalid_argument("SharedMemoryHub needs at least one rank");
+  m_mailboxes.reserve(size);
+  for (int r = 0; r < size; r++) m_mailboxes.push_back(std::make_unique<Mailbox>());
+}
+
+ThreadedTransport::ThreadedTransport(SharedMemoryHub &hub, int rank) : m_hub(hub), m_rank(rank) {
+  if (rank < 0 || rank >= hub.size()) throw std::out_of_range("Rank outside of the hub");
+}
+
+Transport::Request ThreadedTransport::isend_bytes(int dest, int tag,
+                                                  std::span<const std::byte> data) {
+  auto &mailbox = *m_hub.m_mailboxes.at(dest);
+  {
+    std::lock_guard lock(mailbox.mutex);
+    mailbox.messages[{m_rank, tag}].emplace_back(data.begin(), data.end());
+  }
+  mailbox.cv.notify_all();
+  return COMPLETED;
+}
+
+Transport::Request ThreadedTransport::irecv_bytes(int source, int tag,
+                                                  std::span<std::byte> data) {
+  if (source < 0 || source >= m_hub.size()) throw std::out_of_range("Rank outside of the hub");
+  m_pending.push_back({source, tag, data, false});
+  m_open++;
+  return m_first_id + m_pending.size() - 1;
+}
+
+void ThreadedTransport::wait(Request request) {
+  if (request == COMPLETED || request < m_first_id) return;
+  auto &pending = m_pending.at(request - m_first_id);
+  if (pending.done) return;
+
+  auto &mailbox = *m_hub.m_mailboxes[m_rank];
+  std::vector<std::byte> message;
+  {
+    std::unique_lock lock(mailbox.mutex);
+    auto &queue = mailbox.messages[{pending.source, pending.tag}];
+    if (!mailbox.cv.wait(lock, m_hub.m_stop.get_token(), [&queue] { return !queue.empty(); })) {
+      throw std::runtime_error("Receive interrupted: another rank failed");
+    }
+    message = std::move(queue.front());
+    queue.pop_front();
+  }
+  if (message.size() != pending.buffer.size()) {
+    throw std::runtime_error("Received message size does not match the receive buffer");
+  }
+  std::ranges::copy(message, pending.buffer.begin());
+  pending.done = true;
+
+  if (--m_open == 0) {
+    m_first_id += m_pending.size();
+    m_pending.clear();
+  }
+}
+
+void ThreadedTransport::barrier() {
+  std::unique_lock lock(m_hub.m_barrier_mutex);
+  const std::size_t generation = m_hub.m_generation;
+  if (++m_hub.m_arrived == m_hub.size()) {
+    m_hub.m_arrived = 0;
+    m_hub.m_generation++;
+    m_hub.m_barrier_cv.notify_all();
+    return;
+  }
+  if (!m_hub.m_barrier_cv.wait(lock, m_hub.m_stop.get_token(),
+                               [&] { return m_hub.m_generation != generation; })) {
+    throw std::runtime_error("Barrier interrupted: another rank failed");
+  }
+}
+
+void run_threaded(int n_ranks, const std::function<void(Transport &)> &fn) {
+  SharedMemoryHub hub(n_ranks);
+  // the rank that failed first records its error before aborting, so it wins over the errors
+  // of the peers it interrupts
+  std::exception_ptr error;
+  std::once_flag first_error;
+  {
+    std::vector<std::jthread> threads;
+    threads.reserve(n_ranks);
+    for (int r = 0; r < n_ranks; r++) {
+      threads.emplace_back([&hub, &fn, &error, &first_error, r] {
+        try {
+          ThreadedTransport transport(hub, r);
+          fn(transport);
+        } catch (...) {
+          std::call_once(first_error, [&error] { error = std::current_exception(); });
+          hub.abort();
+        }
+      });
+    }
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+}  // namespace oiseau::parallel
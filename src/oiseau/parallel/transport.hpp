@@ -0,0 +1,123 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stop_token>
+#include <utility>
+#include <vector>
+
+namespace oiseau::parallel {
+
+/**
+ * @brief Point-to-point message passing between ranks.
+ *
+ * Mirrors the non-blocking subset of MPI used by the halo exchange: messages are matched by
+ * (source, tag) in FIFO order and buffers must stay alive until the request is waited on.
+ */
+class Transport {
+ public:
+  using Request = std::size_t;
+
+  virtual ~Transport() = default;
+  virtual int rank() const = 0;
+  virtual int size() const = 0;
+  virtual Request isend_bytes(int dest, int tag, std::span<const std::byte> data) = 0;
+  virtual Request irecv_bytes(int source, int tag, std::span<std::byte> data) = 0;
+  virtual void wait(Request request) = 0;
+  virtual void barrier() = 0;
+
+  template <typename T>
+  Request isend(int dest, int tag, std::span<const T> data) {
+    return isend_bytes(dest, tag, std::as_bytes(data));
+  }
+  template <typename T>
+  Request irecv(int source, int tag, std::span<T> data) {
+    return irecv_bytes(source, tag, std::as_writable_bytes(data));
+  }
+  void wait_all(std::span<const Request> requests) {
+    for (auto request : requests) wait(request);
+  }
+};
+
+/**
+ * @brief Mailboxes shared by the ranks of a `ThreadedTransport` group, one rank per thread.
+ *
+ * After `abort`, every rank blocked in a receive or barrier of the group, or entering one later,
+ * throws instead of waiting for peers that may never arrive.
+ */
+class SharedMemoryHub {
+ public:
+  explicit SharedMemoryHub(int size);
+  int size() const { return m_size; }
+  void abort() { m_stop.request_stop(); }
+  bool aborted() const { return m_stop.stop_requested(); }
+
+ private:
+  friend class ThreadedTransport;
+  struct Mailbox {
+    std::mutex mutex;
+    std::condition_variable_any cv;
+    std::map<std::pair<int, int>, std::deque<std::vector<std::byte>>> messages;
+  };
+  int m_size;
+  std::vector<std::unique_ptr<Mailbox>> m_mailboxes;
+  std::stop_source m_stop;
+  // barrier state; the generation tells a new round from the one being released
+  std::mutex m_barrier_mutex;
+  std::condition_variable_any m_barrier_cv;
+  int m_arrived = 0;
+  std::size_t m_generation = 0;
+};
+
+/**
+ * @brief In-process stand-in for a distributed transport.
+ *
+ * Sends are eager: the payload is copied into the receiver's mailbox and the request completes
+ * immediately. Receives complete in `wait`, which blocks until a matching message arrives.
+ */
+class ThreadedTransport : public Transport {
+ public:
+  ThreadedTransport(SharedMemoryHub &hub, int rank);
+  int rank() const override { return m_rank; }
+  int size() const override { return m_hub.size(); }
+  Request isend_bytes(int dest, int tag, std::span<const std::byte> data) override;
+  Request irecv_bytes(int source, int tag, std::span<std::byte> data) override;
+  void wait(Request request) override;
+  void barrier() override;
+
+ private:
+  struct PendingRecv {
+    int source;
+    int tag;
+    std::span<std::byte> buffer;
+    bool done;
+  };
+  SharedMemoryHub &m_hub;
+  int m_rank;
+  // receive requests are numbered m_first_id + index; the list is dropped once all complete
+  std::vector<PendingRecv> m_pending;
+  std::size_t m_first_id = 0;
+  std::size_t m_open = 0;
+};
+
+/**
+ * @brief Runs `fn` on `n_ranks` threads, each with its own `ThreadedTransport`.
+ *
+ * A rank that throws aborts the hub, so its peers fail out of `wait` and `barrier` instead of
+ * blocking forever. The first exception is rethrown after all threads have joined.
+ */
+void run_threaded(int n_ranks, const std::function<void(Transport &)> &fn);
+
+}  // namespace oiseau::parallel
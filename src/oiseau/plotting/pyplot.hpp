@@ -14,7 +14,10 @@
 #include <pybind11/pytypes.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <utility>
+#include <vector>
 #include <xtensor/containers/xarray.hpp>
 #include <xtensor/core/xexpression.hpp>
 #include <xtensor/core/xtensor_forward.hpp>
@@ -24,17 +27,75 @@ using namespace py::literals;
 
 namespace pybind11::detail {
 
+/// NumPy array over the memory of `src`, kept valid by `base`.
+template <typename T>
+array_t<T> xarray_view(const xt::xarray<T> &src, handle base, bool writeable) {
+  std::vector<ssize_t> shape(src.shape().begin(), src.shape().end());
+  std::vector<ssize_t> strides(src.strides().begin(), src.strides().end());
+  for (auto &s : strides) s *= static_cast<ssize_t>(sizeof(T));
+  array_t<T> result(std::move(shape), std::move(strides), src.data(), base);
+  if (!writeable) result.attr("setflags")("write"_a = false);
+  return result;
+}
+
+/// Moves `src` to the heap and hands it to a capsule owning the returned array; no copy.
+template <typename T>
+handle xarray_adopt(xt::xarray<T> &&src) {
+  auto *owned = new xt::xarray<T>(std::move(src));
+  capsule owner(owned, [](void *p) { delete static_cast<xt::xarray<T> *>(p); });
+  return xarray_view(*owned, owner, true).release();
+}
+
+/**
+ * @brief Converts `xt::xarray` to and from NumPy arrays.
+ *
+ * Rvalues are moved into the returned array. Lvalues are aliased under the `reference` and
+ * `reference_internal` policies, the latter keeping `parent` alive, and copied otherwise, so a
+ * Python object never outlives the memory it points to. Const lvalues come out read-only.
+ */
 template <typename T>
 struct type_caster<xt::xarray<T>> {
  public:
-  PYBIND11_TYPE_CASTER(xt::xarray<T>, const_name("xarray"));
-  static handle cast(xt::xarray<T> &src, return_value_policy, handle) {
-    auto v = py::array(src.size(), src.data(), py::capsule([]() {}));
-    v.resize(src.shape());
-    return v.release();
+  PYBIND11_TYPE_CASTER(xt::xarray<T>, const_name("numpy.ndarray"));
+
+  bool load(handle src, bool convert) {
+    if (!convert && !array_t<T>::check_(src)) return false;
+    auto buf = array_t<T, array::c_style | array::forcecast>::ensure(src);
+    if (!buf) return false;
+    std::vector<std::size_t> shape(buf.shape(), buf.shape() + buf.ndim());
+    value = xt::xarray<T>::from_shape(shape);
+    std::copy(buf.data(), buf.data() + buf.size(), value.data());
+    return true;
+  }
+
+  static handle cast(xt::xarray<T> &&src, return_value_policy, handle) {
+    return xarray_adopt(std::move(src));
+  }
+
+  static handle cast(xt::xarray<T> &src, return_value_policy policy, handle parent) {
+    return cast_lvalue(src, policy, parent, true);
+  }
+
+  static handle cast(const xt::xarray<T> &src, return_value_policy policy, handle parent) {
+    return cast_lvalue(src, policy, parent, false);
+  }
+
+ private:
+  static handle cast_lvalue(const xt::xarray<T> &src, return_value_policy policy, handle parent,
+                            bool writeable) {
+    switch (policy) {
+    case return_value_policy::reference:
+      // the caller vouches for the lifetime of src; an empty capsule stops NumPy copying
+      return xarray_view(src, capsule([]() {}), writeable).release();
+    case return_value_policy::reference_internal:
+      return xarray_view(src, parent, writeable).release();
+    default:
+      return xarray_adopt(xt::xarray<T>(src));
+    }
   }
 };
 
+/// Evaluates xtensor expressions once, straight into the buffer handed to NumPy.
 template <typename E>
   requires xt::is_xexpression<E>::value
 struct type_caster<E> {
@@ -43,12 +104,7 @@ struct type_caster<E> {
 
   PYBIND11_TYPE_CASTER(array_type, _("xexpression"));
   static handle cast(const E &expr, return_value_policy, handle) {
-    xt::xarray<value_type> tmp = xt::eval(expr);
-    auto *data_holder = new xt::xarray<double>(std::move(tmp));
-    py::capsule owner_capsule(data_holder,
-                              [](void *p) { delete static_cast<xt::xarray<value_type> *>(p); });
-    py::array result(data_holder->shape(), data_holder->data(), owner_capsule);
-    return result.release();
+    return xarray_adopt(array_type(expr));
   }
 };
 
@@ -93,6 +149,8 @@ class PYBIND11_EXPORT AxesSubPlot {
   DEFINE_PY_CLASS_METHOD_AUTO(scatter)
   DEFINE_PY_CLASS_METHOD_AUTO(triplot)
   DEFINE_PY_CLASS_METHOD_AUTO(plot)
+  DEFINE_PY_CLASS_METHOD_AUTO(add_collection)
+  DEFINE_PY_CLASS_METHOD_AUTO(autoscale_view)
   DEFINE_PY_CLASS_METHOD_AUTO(text)
   DEFINE_PY_CLASS_METHOD_AUTO(set_xlabel)
   DEFINE_PY_CLASS_METHOD_AUTO(set_ylabel)
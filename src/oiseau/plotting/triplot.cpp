@@ -7,44 +7,58 @@
 #include "oiseau/plotting/triplot.hpp"
 
 #include <pybind11/cast.h>
+#include <pybind11/numpy.h>
 
 #include <algorithm>
 #include <cstddef>
+#include <utility>
 #include <vector>
-#include <xtensor/containers/xadapt.hpp>
-#include <xtensor/containers/xbuffer_adaptor.hpp>
-#include <xtensor/views/xslice.hpp>
-#include <xtensor/views/xview.hpp>
 
+#include "oiseau/mesh/cell.hpp"
 #include "oiseau/mesh/mesh.hpp"
 
 namespace oiseau::plotting {
 
-void triplot(plt::AxesSubPlot &ax, oiseau::mesh::Mesh &mesh) {
-  auto topology = mesh.topology();
-  auto geometry = mesh.geometry();
+void triplot(plt::AxesSubPlot &ax, const oiseau::mesh::Mesh &mesh) {
+  const auto &topology = mesh.topology();
+  const auto &geometry = mesh.geometry();
   auto connectivity = topology.conn();
-  auto x = geometry.x();
-
-  std::vector<std::size_t> shape = {x.size() / geometry.dim(), geometry.dim()};
-  auto coords = xt::adapt(x.data(), x.size(), xt::no_ownership(), shape);
+  auto cell_types = topology.cell_types();
 
+  // edges as sorted vertex pairs, so that the copies from neighbouring cells compare equal
+  std::vector<std::pair<std::size_t, std::size_t>> edges;
+  oiseau::mesh::CellType cell = nullptr;
+  std::vector<std::vector<int>> cell_edges;
   for (std::size_t i = 0; i < connectivity.size(); ++i) {
-    auto cell = topology.cell_types()[i];
-    auto conn = connectivity[i];
-
-    auto face_vertices = cell->get_entity_vertices(1);
-    for (const auto &face_vertice : face_vertices) {
-      std::vector<std::size_t> temp(face_vertice.size());
-      std::ranges::transform(face_vertice, temp.begin(),
-                             [&conn](std::size_t idx) { return conn[idx]; });
-
-      auto co = xt::view(coords, xt::keep(temp));
-      auto xx = xt::col(co, 0);
-      auto yy = xt::col(co, 1);
-      ax.plot(xx, yy, "color"_a = "k");
+    if (cell_types[i] != cell) {
+      cell = cell_types[i];
+      cell_edges = cell->get_entity_vertices(1);
+    }
+    const auto &conn = connectivity[i];
+    for (const auto &edge : cell_edges) {
+      auto [a, b] = std::minmax(conn[edge[0]], conn[edge[1]]);
+      edges.emplace_back(a, b);
     }
   }
+  std::ranges::sort(edges);
+  auto [first, last] = std::ranges::unique(edges);
+  edges.erase(first, last);
+
+  const auto n_edges = static_cast<py::ssize_t>(edges.size());
+  py::array_t<double> segments({n_edges, py::ssize_t{2}, py::ssize_t{2}});
+  double *s = segments.mutable_data();
+  for (const auto &[a, b] : edges) {
+    auto xa = geometry.x_at(a);
+    auto xb = geometry.x_at(b);
+    *s++ = xa[0];
+    *s++ = geometry.dim() > 1 ? xa[1] : 0.0;
+    *s++ = xb[0];
+    *s++ = geometry.dim() > 1 ? xb[1] : 0.0;
+  }
+
+  auto collections = py::module_::import("matplotlib.collections");
+  ax.add_collection(collections.attr("LineCollection")(segments, "colors"_a = "k"));
+  ax.autoscale_view();
 }
 
 }  // namespace oiseau::plotting
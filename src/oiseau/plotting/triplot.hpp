@@ -10,5 +10,11 @@
 #include "oiseau/plotting/pyplot.hpp"
 
 namespace oiseau::plotting {
-void triplot(plt::AxesSubPlot &ax, oiseau::mesh::Mesh &mesh);
+/**
+ * @brief Draws the edges of `mesh` projected on the xy plane.
+ *
+ * Edges shared by several cells are drawn once, and all of them go to matplotlib in a single
+ * `LineCollection` built from one (n_edges x 2 x 2) numpy array.
+ */
+void triplot(plt::AxesSubPlot &ax, const oiseau::mesh::Mesh &mesh);
 }
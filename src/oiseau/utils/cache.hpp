@@ -0,0 +1,35 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <mutex>
+#include <utility>
+
+namespace oiseau::utils {
+
+/**
+ * @brief Returns the entry of `cache` for `key`, building it with `make()` when it is missing.
+ *
+ * The mutex is held for the lookup and the insertion only, so threads building different keys
+ * run in parallel. Two threads missing the same key may both build it; the first insertion wins
+ * and the other result is dropped. `Map` must be node-based (`std::map`, `std::unordered_map`)
+ * so that the returned reference stays valid as the cache grows.
+ */
+template <class Map, class Make>
+typename Map::mapped_type &cached(Map &cache, std::mutex &mutex,
+                                  const typename Map::key_type &key, Make &&make) {
+  {
+    std::lock_guard lock(mutex);
+    auto it = cache.find(key);
+    if (it != cache.end()) return it->second;
+  }
+  typename Map::mapped_type value = make();
+  std::lock_guard lock(mutex);
+  return cache.try_emplace(key, std::move(value)).first->second;
+}
+
+}  // namespace oiseau::utils
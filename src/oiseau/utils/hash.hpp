@@ -0,0 +1,31 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+
+namespace oiseau::utils {
+
+/// Mixes the hash of `value` into `seed`, as boost::hash_combine does.
+template <class T>
+void hash_combine(std::size_t &seed, const T &value) {
+  seed ^= std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+/// Hash of a fixed-size array, e.g. the sorted vertices keying an edge or a face.
+struct ArrayHash {
+  template <class T, std::size_t N>
+  std::size_t operator()(const std::array<T, N> &key) const {
+    std::size_t seed = 0;
+    for (const auto &v : key) hash_combine(seed, v);
+    return seed;
+  }
+};
+
+}  // namespace oiseau::utils
@@ -9,9 +9,12 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <map>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 #include <xtensor-blas/xlinalg.hpp>
 #include <xtensor/containers/xadapt.hpp>
 #include <xtensor/containers/xarray.hpp>
@@ -29,6 +32,8 @@
 #include <xtensor/views/xview.hpp>
 
 #include "oiseau/dg/nodal/utils.hpp"
+#include "oiseau/utils/cache.hpp"
+#include "oiseau/utils/math.hpp"
 
 namespace {
 
@@ -41,60 +46,60 @@ namespace {
 // http://www.cs.kuleuven.ac.be/~nines/research/ecf/ecf.html
 
 // For cub2D_1: 1 point
-static const std::array<double, 1 * 2> cub2D_1_nodes_data = {
+constexpr std::array<double, 1 * 2> cub2D_1_nodes_data = {
     {-0.333333333333333, -0.333333333333333}};
-static const std::array<double, 1> cub2D_1_weights_data = {{2.000000000000000}};
+constexpr std::array<double, 1> cub2D_1_weights_data = {{2.000000000000000}};
 
 // For cub2D_2: 3 points
-static const std::array<double, 3 * 2> cub2D_2_nodes_data = {
+constexpr std::array<double, 3 * 2> cub2D_2_nodes_data = {
     {-0.666666666666667, -0.666666666666667, 0.333333333333333, -0.666666666666667,
      -0.666666666666667, 0.333333333333333}};
-static const std::array<double, 3> cub2D_2_weights_data = {
+constexpr std::array<double, 3> cub2D_2_weights_data = {
     {0.666666666666667, 0.666666666666667, 0.666666666666667}};
 
 // For cub2D_3: 6 points
-static const std::array<double, 6 * 2> cub2D_3_nodes_data = {
+constexpr std::array<double, 6 * 2> cub2D_3_nodes_data = {
     {-0.816847572980458, -0.816847572980458, 0.633695145960917, -0.816847572980459,
      -0.816847572980459, 0.633695145960917, -0.108103018168070, -0.108103018168070,
      -0.783793963663860, -0.108103018168070, -0.108103018168070, -0.783793963663860}};
-static const std::array<double, 6> cub2D_3_weights_data = {{0.219903487310644, 0.219903487310644,
+constexpr std::array<double, 6> cub2D_3_weights_data = {{0.219903487310644, 0.219903487310644,
                                                             0.219903487310644, 0.446763179356023,
                                                             0.446763179356023, 0.446763179356023}};
 
 // For cub2D_4: 6 points
-static const std::array<double, 6 * 2> cub2D_4_nodes_data = {
+constexpr std::array<double, 6 * 2> cub2D_4_nodes_data = {
     {-0.816847572980458, -0.816847572980458, 0.633695145960917, -0.816847572980459,
      -0.816847572980459, 0.633695145960917, -0.108103018168070, -0.108103018168070,
      -0.783793963663860, -0.108103018168070, -0.108103018168070, -0.783793963663860}};
-static const std::array<double, 6> cub2D_4_weights_data = {{0.219903487310644, 0.219903487310644,
+constexpr std::array<double, 6> cub2D_4_weights_data = {{0.219903487310644, 0.219903487310644,
                                                             0.219903487310644, 0.446763179356023,
                                                             0.446763179356023, 0.446763179356023}};
 
 // For cub2D_5: 7 points
-static const std::array<double, 7 * 2> cub2D_5_nodes_data = {
+constexpr std::array<double, 7 * 2> cub2D_5_nodes_data = {
     {-0.333333333333333, -0.333333333333333, -0.059715871789770, -0.059715871789770,
      -0.880568256420460, -0.059715871789770, -0.059715871789770, -0.880568256420460,
      -0.797426985353087, -0.797426985353087, 0.594853970706175, -0.797426985353087,
      -0.797426985353087, 0.594853970706175}};
-static const std::array<double, 7> cub2D_5_weights_data = {
+constexpr std::array<double, 7> cub2D_5_weights_data = {
     {0.450000000000000, 0.264788305577012, 0.264788305577012, 0.264788305577012, 0.251878361089654,
      0.251878361089654, 0.251878361089654}};
 
 // For cub2D_6: 12 points
-static const std::array<double, 12 * 2> cub2D_6_nodes_data = {
+constexpr std::array<double, 12 * 2> cub2D_6_nodes_data = {
     {-0.501426509658179, -0.501426509658179, 0.002853019316358,  -0.501426509658179,
      -0.501426509658179, 0.002853019316358,  -0.873821971016996, -0.873821971016996,
      0.747643942033991,  -0.873821971016996, -0.873821971016996, 0.747643942033991,
      -0.379295097932431, -0.893709900310366, -0.893709900310366, -0.379295097932431,
      0.273004998242797,  -0.893709900310366, -0.893709900310366, 0.273004998242797,
      0.273004998242797,  -0.379295097932431, -0.379295097932431, 0.273004998242797}};
-static const std::array<double, 12> cub2D_6_weights_data = {
+constexpr std::array<double, 12> cub2D_6_weights_data = {
     {0.233572551452759, 0.233572551452759, 0.233572551452759, 0.101689812740414, 0.101689812740414,
      0.101689812740414, 0.165702151236747, 0.165702151236747, 0.165702151236747, 0.165702151236747,
      0.165702151236747, 0.165702151236747}};
 
 // For cub2D_7: 15 points
-static const std::array<double, 15 * 2> cub2D_7_nodes_data = {
+constexpr std::array<double, 15 * 2> cub2D_7_nodes_data = {
     {-0.158765070723907, -0.158765070723907, -0.682469858552186, -0.158765070723907,
      -0.158765070723907, -0.682469858552186, -0.901937632421608, -0.901937632421608,
      0.803875264843215,  -0.901937632421608, -0.901937632421608, 0.803875264843215,
@@ -103,14 +108,14 @@ static const std::array<double, 15 * 2> cub2D_7_nodes_data = {
      -0.375762055856278, 0.348275575962283,  -0.972513520106005, -0.375762055856278,
      -0.375762055856278, -0.972513520106005, -0.972513520106005, 0.348275575962283,
      0.348275575962283,  -0.972513520106005}};
-static const std::array<double, 15> cub2D_7_weights_data = {
+constexpr std::array<double, 15> cub2D_7_weights_data = {
     {0.278402959350494, 0.278402959350494, 0.278402959350494, 0.063653882657145, 0.063653882657145,
      0.063653882657145, 0.168642646759703, 0.168642646759703, 0.168642646759703, 0.077983588949662,
      0.077983588949662, 0.077983588949662, 0.077983588949662, 0.077983588949662,
      0.077983588949662}};
 
 // For cub2D_8: 16 points
-static const std::array<double, 16 * 2> cub2D_8_nodes_data = {
+constexpr std::array<double, 16 * 2> cub2D_8_nodes_data = {
     {-0.333333333333333, -0.333333333333333, -0.081414823414554, -0.081414823414554,
      -0.837170353170893, -0.081414823414554, -0.081414823414554, -0.837170353170893,
      -0.658861384496480, -0.658861384496480, 0.317722768992959,  -0.658861384496480,
@@ -119,14 +124,14 @@ static const std::array<double, 16 * 2> cub2D_8_nodes_data = {
      -0.473774340730724, 0.456984785910809,  0.456984785910809,  -0.473774340730724,
      -0.983210445180085, 0.456984785910809,  0.456984785910809,  -0.983210445180085,
      -0.983210445180085, -0.473774340730724, -0.473774340730724, -0.983210445180085}};
-static const std::array<double, 16> cub2D_8_weights_data = {
+constexpr std::array<double, 16> cub2D_8_weights_data = {
     {0.288631215355574, 0.190183268534569, 0.190183268534569, 0.190183268534569, 0.206434741069437,
      0.206434741069437, 0.206434741069437, 0.064916995246396, 0.064916995246396, 0.064916995246396,
      0.054460628348870, 0.054460628348870, 0.054460628348870, 0.054460628348870, 0.054460628348870,
      0.054460628348870}};
 
 // For cub2D_9: 19 points (19*3 = 57 elements)
-static const std::array<double, 19 * 2> cub2D_9_nodes_data = {
+constexpr std::array<double, 19 * 2> cub2D_9_nodes_data = {
     {-0.333333333333333, -0.333333333333333, -0.020634961602525, -0.020634961602525,
      -0.958730076794950, -0.020634961602525, -0.020634961602525, -0.958730076794950,
      -0.125820817014127, -0.125820817014127, -0.748358365971746, -0.125820817014127,
@@ -137,14 +142,14 @@ static const std::array<double, 19 * 2> cub2D_9_nodes_data = {
      -0.556074021678469, 0.482397197568996,  -0.926323175890527, -0.556074021678469,
      -0.556074021678469, -0.926323175890527, -0.926323175890527, 0.482397197568996,
      0.482397197568996,  -0.926323175890527}};
-static const std::array<double, 19> cub2D_9_weights_data = {
+constexpr std::array<double, 19> cub2D_9_weights_data = {
     {0.194271592565598, 0.062669400454278, 0.062669400454278, 0.062669400454278, 0.155655082009549,
      0.155655082009549, 0.155655082009549, 0.159295477854420, 0.159295477854420, 0.159295477854420,
      0.051155351317396, 0.051155351317396, 0.051155351317396, 0.086567078754579, 0.086567078754579,
      0.086567078754579, 0.086567078754579, 0.086567078754579, 0.086567078754579}};
 
 // For cub2D_10: 25 points (25*3 = 75 elements)
-static const std::array<double, 25 * 2> cub2D_10_nodes_data = {
+constexpr std::array<double, 25 * 2> cub2D_10_nodes_data = {
     {-0.333333333333333, -0.333333333333333, -0.004269134091050, -0.004269134091050,
      -0.991461731817899, -0.004269134091050, -0.004269134091050, -0.991461731817899,
      -0.143975100541888, -0.143975100541888, -0.712049798916225, -0.143975100541888,
@@ -158,7 +163,7 @@ static const std::array<double, 25 * 2> cub2D_10_nodes_data = {
      0.259414658305837,  -0.334512798822723, -0.924901859483115, 0.259414658305837,
      0.259414658305837,  -0.924901859483115, -0.924901859483115, -0.334512798822723,
      -0.334512798822723, -0.924901859483115}};
-static const std::array<double, 25> cub2D_10_weights_data = {
+constexpr std::array<double, 25> cub2D_10_weights_data = {
     {0.167046799610393, 0.014459701184113, 0.014459701184113, 0.014459701184113,
      0.148984355841961, 0.148984355841961, 0.148984355841961, 0.157292946806217,
      0.157292946806217, 0.157292946806217, 0.013856646174215, 0.013856646174215,
@@ -168,7 +173,7 @@ static const std::array<double, 25> cub2D_10_weights_data = {
      0.079158734392122}};
 
 // For cub2D_11: 28 points (28*3 = 84 elements)
-static const std::array<double, 28 * 2> cub2D_11_nodes_data = {
+constexpr std::array<double, 28 * 2> cub2D_11_nodes_data = {
     {-0.333333333333333, -0.333333333333333, -0.008227986519701, -0.008227986519701,
      -0.983544026960598, -0.008227986519701, -0.008227986519701, -0.983544026960598,
      -0.123062767323470, -0.123062767323470, -0.753874465353061, -0.123062767323470,
@@ -183,7 +188,7 @@ static const std::array<double, 28 * 2> cub2D_11_nodes_data = {
      -0.420944470627256, 0.328932876191794,  0.328932876191794,  -0.420944470627256,
      -0.907988405564538, 0.328932876191794,  0.328932876191794,  -0.907988405564538,
      -0.907988405564538, -0.420944470627256, -0.420944470627256, -0.907988405564538}};
-static const std::array<double, 28> cub2D_11_weights_data = {
+constexpr std::array<double, 28> cub2D_11_weights_data = {
     {0.171542269659139, 0.033232309648099, 0.033232309648099, 0.033232309648099, 0.134650934561697,
      0.134650934561697, 0.134650934561697, 0.141045284213931, 0.141045284213931, 0.141045284213931,
      0.077255352409353, 0.077255352409353, 0.077255352409353, 0.020851693311810, 0.020851693311810,
@@ -192,7 +197,7 @@ static const std::array<double, 28> cub2D_11_weights_data = {
      0.080668713854259, 0.080668713854259, 0.080668713854259}};
 
 // For cub2D_12: 36 points (36*3 = 108 elements)
-static const std::array<double, 36 * 2> cub2D_12_nodes_data = {
+constexpr std::array<double, 36 * 2> cub2D_12_nodes_data = {
     {-0.115127288420454, -0.115127288420454, -0.769745423159092, -0.115127288420454,
      -0.115127288420454, -0.769745423159092, -0.241326933740970, -0.241326933740970,
      -0.517346132518060, -0.241326933740970, -0.241326933740970, -0.517346132518060,
@@ -211,7 +216,7 @@ static const std::array<double, 36 * 2> cub2D_12_nodes_data = {
      0.380092839755442,  -0.412599349012509, -0.412599349012509, 0.380092839755442,
      -0.967493490742933, -0.412599349012509, -0.412599349012509, -0.967493490742933,
      -0.967493490742933, 0.380092839755442,  0.380092839755442,  -0.967493490742933}};
-static const std::array<double, 36> cub2D_12_weights_data = {
+constexpr std::array<double, 36> cub2D_12_weights_data = {
     {0.088694050812375, 0.088694050812375, 0.088694050812375, 0.083486638970495, 0.083486638970495,
      0.083486638970495, 0.061949370456958, 0.061949370456958, 0.061949370456958, 0.096926744607805,
      0.096926744607805, 0.096926744607805, 0.016284715813394, 0.016284715813394, 0.016284715813394,
@@ -222,7 +227,7 @@ static const std::array<double, 36> cub2D_12_weights_data = {
      0.031692718542038}};
 
 // For cub2D_13: 40 points (40*3 = 120 elements)
-static const std::array<double, 40 * 2> cub2D_13_nodes_data = {
+constexpr std::array<double, 40 * 2> cub2D_13_nodes_data = {
     {-0.333333333333333, -0.333333333333333, -0.178369512906405, -0.178369512906405,
      -0.643260974187191, -0.178369512906405, -0.178369512906405, -0.643260974187191,
      -0.542160866418819, -0.542160866418819, 0.084321732837639,  -0.542160866418819,
@@ -243,7 +248,7 @@ static const std::array<double, 40 * 2> cub2D_13_nodes_data = {
      -0.461147708177324, -0.809703416305633, -0.809703416305633, -0.461147708177324,
      0.270851124482956,  -0.809703416305633, -0.809703416305633, 0.270851124482956,
      0.270851124482956,  -0.461147708177324, -0.461147708177324, 0.270851124482956}};
-static const std::array<double, 40> cub2D_13_weights_data = {
+constexpr std::array<double, 40> cub2D_13_weights_data = {
     {0.097649880256618, 0.090830392435257, 0.090830392435257, 0.090830392435257,
      0.093688172298398, 0.093688172298398, 0.093688172298398, 0.062636625766914,
      0.062636625766914, 0.062636625766914, 0.015384123058757, 0.015384123058757,
@@ -256,7 +261,7 @@ static const std::array<double, 40> cub2D_13_weights_data = {
      0.073599737741711, 0.073599737741711, 0.073599737741711, 0.073599737741711}};
 
 // For cub2D_14: 46 points (46*3 = 138 elements)
-static const std::array<double, 46 * 2> cub2D_14_nodes_data = {
+constexpr std::array<double, 46 * 2> cub2D_14_nodes_data = {
     {-0.333333333333333, -0.333333333333333, -0.031437623162377, -0.031437623162377,
      -0.937124753675245, -0.031437623162377, -0.031437623162377, -0.937124753675245,
      -0.190179067155837, -0.190179067155837, -0.619641865688325, -0.190179067155837,
@@ -280,7 +285,7 @@ static const std::array<double, 46 * 2> cub2D_14_nodes_data = {
      -0.593507885280605, 0.397658756992448,  0.397658756992448,  -0.593507885280605,
      -0.804150871711842, 0.397658756992447,  0.397658756992447,  -0.804150871711842,
      -0.804150871711842, -0.593507885280605, -0.593507885280605, -0.804150871711842}};
-static const std::array<double, 46> cub2D_14_weights_data = {
+constexpr std::array<double, 46> cub2D_14_weights_data = {
     {0.086016161940337, 0.020861042581505, 0.020861042581505, 0.020861042581505, 0.084906577433761,
      0.084906577433761, 0.084906577433761, 0.094412955694385, 0.094412955694385, 0.094412955694385,
      0.036931420530108, 0.036931420530108, 0.036931420530108, 0.009566859223433, 0.009566859223433,
@@ -292,7 +297,7 @@ static const std::array<double, 46> cub2D_14_weights_data = {
      0.056624756038490, 0.056624756038490, 0.056624756038490, 0.056624756038490, 0.056624756038490,
      0.056624756038490}};
 
-static const std::array<double, 54 * 2> cub2D_15_nodes_data = {
+constexpr std::array<double, 54 * 2> cub2D_15_nodes_data = {
     {-0.083438407261750, -0.083438407261750, -0.833123185476500, -0.083438407261750,
      -0.083438407261750, -0.833123185476500, -0.192779070841739, -0.192779070841739,
      -0.614441858316522, -0.192779070841739, -0.192779070841739, -0.614441858316522,
@@ -320,7 +325,7 @@ static const std::array<double, 54 * 2> cub2D_15_nodes_data = {
      -0.436328663801831, 0.099519827552432,  0.099519827552432,  -0.436328663801831,
      -0.663191163750602, 0.099519827552432,  0.099519827552432,  -0.663191163750602,
      -0.663191163750602, -0.436328663801831, -0.436328663801831, -0.663191163750602}};
-static const std::array<double, 54> cub2D_15_weights_data = {
+constexpr std::array<double, 54> cub2D_15_weights_data = {
     {0.065323637697611, 0.065323637697611, 0.065323637697611, 0.054825636062729, 0.054825636062729,
      0.054825636062729, 0.053020073197407, 0.053020073197407, 0.053020073197407, 0.058431924272972,
      0.058431924272972, 0.058431924272972, 0.021169216132488, 0.021169216132488, 0.021169216132488,
@@ -334,7 +339,7 @@ static const std::array<double, 54> cub2D_15_weights_data = {
      0.066176391063291, 0.066176391063291, 0.066176391063291, 0.066176391063291}};
 
 // For cub2D_16: 58 points (58*3 = 174 elements)
-static const std::array<double, 58 * 2> cub2D_16_nodes_data = {
+constexpr std::array<double, 58 * 2> cub2D_16_nodes_data = {
     {-0.333333333333333, -0.333333333333333, -0.015796436959213, -0.015796436959213,
      -0.968407126081574, -0.015796436959213, -0.015796436959213, -0.968407126081574,
      -0.087376299046785, -0.087376299046785, -0.825247401906431, -0.087376299046785,
@@ -364,7 +369,7 @@ static const std::array<double, 58 * 2> cub2D_16_nodes_data = {
      -0.353308953197778, -0.027538833736648, -0.027538833736648, -0.353308953197778,
      -0.619152213065573, -0.027538833736648, -0.027538833736648, -0.619152213065573,
      -0.619152213065573, -0.353308953197778, -0.353308953197778, -0.619152213065573}};
-static const std::array<double, 58> cub2D_16_weights_data = {
+constexpr std::array<double, 58> cub2D_16_weights_data = {
     {0.092421202321849, 0.027991652734724, 0.027991652734724, 0.027991652734724, 0.036406763596424,
      0.036406763596424, 0.036406763596424, 0.062729423327251, 0.062729423327251, 0.062729423327251,
      0.032217170192673, 0.032217170192673, 0.032217170192673, 0.003676792575648, 0.003676792575648,
@@ -379,7 +384,7 @@ static const std::array<double, 58> cub2D_16_weights_data = {
      0.081415677215044, 0.081415677215044, 0.081415677215044}};
 
 // For cub2D_17: 66 points (66*3 = 198 elements)
-static const std::array<double, 66 * 2> cub2D_17_nodes_data = {
+constexpr std::array<double, 66 * 2> cub2D_17_nodes_data = {
     {-0.013565183960096, -0.013565183960096, -0.972869632079808, -0.013565183960096,
      -0.013565183960096, -0.972869632079808, -0.918012666387151, -0.918012666387151,
      0.836025332774302,  -0.918012666387151, -0.918012666387151, 0.836025332774302,
@@ -413,7 +418,7 @@ static const std::array<double, 66 * 2> cub2D_17_nodes_data = {
      -0.258115377755090, -0.067105414124881, -0.067105414124881, -0.258115377755090,
      -0.674779208120030, -0.067105414124880, -0.067105414124880, -0.674779208120030,
      -0.674779208120030, -0.258115377755090, -0.258115377755090, -0.674779208120030}};
-static const std::array<double, 66> cub2D_17_weights_data = {
+constexpr std::array<double, 66> cub2D_17_weights_data = {
     {0.022448424077156, 0.022448424077156, 0.022448424077156, 0.011377816766740, 0.011377816766740,
      0.011377816766740, 0.056148078797670, 0.056148078797670, 0.056148078797670, 0.031804753050686,
      0.031804753050686, 0.031804753050686, 0.042944604159838, 0.042944604159838, 0.042944604159838,
@@ -430,7 +435,7 @@ static const std::array<double, 66> cub2D_17_weights_data = {
      0.045648336152327}};
 
 // For cub2D_18: 73 points (73*3 = 219 elements)
-static const std::array<double, 73 * 2> cub2D_18_nodes_data = {
+constexpr std::array<double, 73 * 2> cub2D_18_nodes_data = {
     {-0.333333333333333, -0.333333333333333, -0.012131216528029, -0.012131216528029,
      -0.975737566943942, -0.012131216528029, -0.012131216528029, -0.975737566943942,
      -0.230136518749796, -0.230136518749796, -0.539726962500408, -0.230136518749796,
@@ -468,7 +473,7 @@ static const std::array<double, 73 * 2> cub2D_18_nodes_data = {
      0.233062121320884,  -0.507963230765286, -0.725098890555598, 0.233062121320884,
      0.233062121320884,  -0.725098890555598, -0.725098890555598, -0.507963230765286,
      -0.507963230765286, -0.725098890555598}};
-static const std::array<double, 73> cub2D_18_weights_data = {
+constexpr std::array<double, 73> cub2D_18_weights_data = {
     {0.044365924378076, 0.019118866558615, 0.019118866558615, 0.019118866558615, 0.049294282264207,
      0.049294282264207, 0.049294282264207, 0.060654125981259, 0.060654125981259, 0.060654125981259,
      0.031366231844497, 0.031366231844497, 0.031366231844497, 0.016173035699059, 0.016173035699059,
@@ -486,7 +491,7 @@ static const std::array<double, 73> cub2D_18_weights_data = {
      0.045433087546729, 0.045433087546729, 0.045433087546729}};
 
 // For cub2D_19: 82 points (82*3 = 246 elements)
-static const std::array<double, 82 * 2> cub2D_19_nodes_data = {
+constexpr std::array<double, 82 * 2> cub2D_19_nodes_data = {
     {-0.333333333333333, -0.333333333333333, -0.121193890022463, -0.121193890022463,
      -0.757612219955075, -0.121193890022463, -0.121193890022463, -0.757612219955075,
      -0.227921589064499, -0.227921589064499, -0.544156821871001, -0.227921589064499,
@@ -528,7 +533,7 @@ static const std::array<double, 82 * 2> cub2D_19_nodes_data = {
      -0.342507806805715, 0.042214391480752,  0.042214391480752,  -0.342507806805715,
      -0.699706584675037, 0.042214391480751,  0.042214391480751,  -0.699706584675037,
      -0.699706584675037, -0.342507806805715, -0.342507806805715, -0.699706584675037}};
-static const std::array<double, 82> cub2D_19_weights_data = {
+constexpr std::array<double, 82> cub2D_19_weights_data = {
     {0.041424760048010, 0.031784855337689, 0.031784855337689, 0.031784855337689, 0.048406599909930,
      0.048406599909930, 0.048406599909930, 0.048177661858475, 0.048177661858475, 0.048177661858475,
      0.042691162490028, 0.042691162490028, 0.042691162490028, 0.031889013978028, 0.031889013978028,
@@ -548,7 +553,7 @@ static const std::array<double, 82> cub2D_19_weights_data = {
      0.042971513130613, 0.042971513130613}};
 
 // For cub2D_20: 85 points (85*3 = 255 elements)
-static const std::array<double, 85 * 2> cub2D_20_nodes_data = {
+constexpr std::array<double, 85 * 2> cub2D_20_nodes_data = {
     {-0.333333333333333, -0.333333333333333, -0.001500649324429, -0.001500649324429,
      -0.996998701351142, -0.001500649324429, -0.001500649324429, -0.996998701351142,
      -0.094139751938951, -0.094139751938951, -0.811720496122098, -0.094139751938951,
@@ -592,7 +597,7 @@ static const std::array<double, 85 * 2> cub2D_20_nodes_data = {
      0.072237177039608,  -0.353658866927485, -0.718578310112123, 0.072237177039608,
      0.072237177039608,  -0.718578310112123, -0.718578310112123, -0.353658866927485,
      -0.353658866927485, -0.718578310112123}};
-static const std::array<double, 85> cub2D_20_weights_data = {
+constexpr std::array<double, 85> cub2D_20_weights_data = {
     {0.055220853995399, 0.003558059094653, 0.003558059094653, 0.003558059094653,
      0.040224796227922, 0.040224796227922, 0.040224796227922, 0.053635694518663,
      0.053635694518663, 0.053635694518663, 0.049046267603004, 0.049046267603004,
@@ -617,7 +622,7 @@ static const std::array<double, 85> cub2D_20_weights_data = {
      0.045636448116791}};
 
 // For cub2D_21: 93 points (93*3 = 279 elements)
-static const std::array<double, 93 * 2> cub2D_21_nodes_data = {
+constexpr std::array<double, 93 * 2> cub2D_21_nodes_data = {
     {-0.006427416686680, -0.006427416686680, -0.987145166626641, -0.006427416686680,
      -0.006427416686680, -0.987145166626641, -0.037371238381685, -0.037371238381685,
      -0.925257523236629, -0.037371238381685, -0.037371238381685, -0.925257523236629,
@@ -666,7 +671,7 @@ static const std::array<double, 93 * 2> cub2D_21_nodes_data = {
      -0.081590222620926, -0.612882744117011, -0.612882744117011, -0.305527033262063,
      -0.305527033262063, -0.612882744117011}};
 
-static const std::array<double, 93> cub2D_21_weights_data = {
+constexpr std::array<double, 93> cub2D_21_weights_data = {
     {0.009411977990382, 0.009411977990382, 0.009411977990382, 0.023551229711283, 0.023551229711283,
      0.023551229711283, 0.041353961937512, 0.041353961937512, 0.041353961937512, 0.045947520102707,
      0.045947520102707, 0.045947520102707, 0.047724273523632, 0.047724273523632, 0.047724273523632,
@@ -688,7 +693,7 @@ static const std::array<double, 93> cub2D_21_weights_data = {
      0.043740300619054, 0.043740300619054, 0.043740300619054}};
 
 // For cub2D_22: 100 points (100*3 = 300 elements)
-static const std::array<double, 100 * 2> cub2D_22_nodes_data = {
+constexpr std::array<double, 100 * 2> cub2D_22_nodes_data = {
     {-0.333333333333333, -0.333333333333333, -0.005980679319437, -0.005980679319437,
      -0.988038641361126, -0.005980679319437, -0.005980679319437, -0.988038641361126,
      -0.112289615572167, -0.112289615572167, -0.775420768855665, -0.112289615572167,
@@ -739,7 +744,7 @@ static const std::array<double, 100 * 2> cub2D_22_nodes_data = {
      -0.388196135129182, 0.068617773977901,  0.068617773977901,  -0.388196135129182,
      -0.680421638848718, 0.068617773977901,  0.068617773977901,  -0.680421638848718,
      -0.680421638848718, -0.388196135129182, -0.388196135129182, -0.680421638848718}};
-static const std::array<double, 100> cub2D_22_weights_data = {
+constexpr std::array<double, 100> cub2D_22_weights_data = {
     {0.052134891986775, 0.002127559342619, 0.002127559342619, 0.002127559342619,
      0.040243429730281, 0.040243429730281, 0.040243429730281, 0.048340550896214,
      0.048340550896214, 0.048340550896214, 0.047378470721283, 0.047378470721283,
@@ -767,7 +772,7 @@ static const std::array<double, 100> cub2D_22_weights_data = {
      0.040865211838584, 0.040865211838584, 0.040865211838584, 0.040865211838584}};
 
 // For cub2D_23: 106 points (106*3 = 318 elements)
-static const std::array<double, 106 * 2> cub2D_23_nodes_data = {
+constexpr std::array<double, 106 * 2> cub2D_23_nodes_data = {
     {-0.333333333333333, -0.333333333333333, -0.023538910955543, -0.023538910955543,
      -0.952922178088914, -0.023538910955543, -0.023538910955543, -0.952922178088914,
      -0.112255282121933, -0.112255282121933, -0.775489435756134, -0.112255282121933,
@@ -821,7 +826,7 @@ static const std::array<double, 106 * 2> cub2D_23_nodes_data = {
      -0.368673747852155, 0.056982821883363,  0.056982821883363,  -0.368673747852155,
      -0.688309074031208, 0.056982821883363,  0.056982821883363,  -0.688309074031208,
      -0.688309074031208, -0.368673747852155, -0.368673747852155, -0.688309074031208}};
-static const std::array<double, 106> cub2D_23_weights_data = {
+constexpr std::array<double, 106> cub2D_23_weights_data = {
     {0.049993627092845, 0.008227775544650, 0.008227775544650, 0.008227775544650, 0.037662477311797,
      0.037662477311797, 0.037662477311797, 0.046916667243031, 0.046916667243031, 0.046916667243031,
      0.047191879210718, 0.047191879210718, 0.047191879210718, 0.039689081561875, 0.039689081561875,
@@ -846,7 +851,7 @@ static const std::array<double, 106> cub2D_23_weights_data = {
      0.041389027831224}};
 
 // For cub2D_24: 118 points (118*3 = 354 elements)
-static const std::array<double, 118 * 2> cub2D_24_nodes_data = {
+constexpr std::array<double, 118 * 2> cub2D_24_nodes_data = {
     {-0.333333333333333, -0.333333333333333, -0.031382760283421, -0.031382760283421,
      -0.937234479433159, -0.031382760283421, -0.031382760283421, -0.937234479433159,
      -0.120096233850662, -0.120096233850662, -0.759807532298676, -0.120096233850662,
@@ -906,7 +911,7 @@ static const std::array<double, 118 * 2> cub2D_24_nodes_data = {
      -0.344489563789357, 0.009282127094255,  0.009282127094255,  -0.344489563789357,
      -0.664792563304898, 0.009282127094255,  0.009282127094255,  -0.664792563304898,
      -0.664792563304898, -0.344489563789357, -0.344489563789357, -0.664792563304898}};
-static const std::array<double, 118> cub2D_24_weights_data = {
+constexpr std::array<double, 118> cub2D_24_weights_data = {
     {0.031330242175782, 0.014717653847587, 0.014717653847587, 0.014717653847587, 0.030963348398970,
      0.030963348398970, 0.030963348398970, 0.037986940843648, 0.037986940843648, 0.037986940843648,
      0.033466254011049, 0.033466254011049, 0.033466254011049, 0.029203686754054, 0.029203686754054,
@@ -933,7 +938,7 @@ static const std::array<double, 118> cub2D_24_weights_data = {
      0.033972574031807, 0.033972574031807, 0.033972574031807}};
 
 // For cub2D_25: 126 points (126*3 = 378 elements)
-static const std::array<double, 126 * 2> cub2D_25_nodes_data = {
+constexpr std::array<double, 126 * 2> cub2D_25_nodes_data = {
     {-0.027946483073174, -0.027946483073174, -0.944107033853652, -0.027946483073174,
      -0.027946483073174, -0.944107033853652, -0.131178601327651, -0.131178601327651,
      -0.737642797344697, -0.131178601327651, -0.131178601327651, -0.737642797344697,
@@ -997,7 +1002,7 @@ static const std::array<double, 126 * 2> cub2D_25_nodes_data = {
      -0.348763754808032, -0.034779976926618, -0.034779976926618, -0.348763754808032,
      -0.616456268265350, -0.034779976926618, -0.034779976926618, -0.616456268265350,
      -0.616456268265350, -0.348763754808032, -0.348763754808032, -0.616456268265350}};
-static const std::array<double, 126> cub2D_25_weights_data = {
+constexpr std::array<double, 126> cub2D_25_weights_data = {
     {0.016011163760041, 0.016011163760041, 0.016011163760041, 0.031894153664781, 0.031894153664781,
      0.031894153664781, 0.026218282461591, 0.026218282461591, 0.026218282461591, 0.039166001931271,
      0.039166001931271, 0.039166001931271, 0.032941770883075, 0.032941770883075, 0.032941770883075,
@@ -1026,7 +1031,7 @@ static const std::array<double, 126> cub2D_25_weights_data = {
      0.029762759122336}};
 
 // For cub2D_26: 138 points (138*3 = 414 elements)
-static const std::array<double, 138 * 2> cub2D_26_nodes_data = {
+constexpr std::array<double, 138 * 2> cub2D_26_nodes_data = {
     {-0.027285103318006, -0.027285103318006, -0.945429793363989, -0.027285103318006,
      -0.027285103318006, -0.945429793363989, -0.068629018183452, -0.068629018183452,
      -0.862741963633096, -0.068629018183452, -0.068629018183452, -0.862741963633096,
@@ -1096,7 +1101,7 @@ static const std::array<double, 138 * 2> cub2D_26_nodes_data = {
      -0.373996265063702, -0.064072130507071, -0.064072130507071, -0.373996265063702,
      -0.561931604429227, -0.064072130507071, -0.064072130507071, -0.561931604429227,
      -0.561931604429227, -0.373996265063702, -0.373996265063702, -0.561931604429227}};
-static const std::array<double, 138> cub2D_26_weights_data = {
+constexpr std::array<double, 138> cub2D_26_weights_data = {
     {0.005361616431413, 0.005361616431413, 0.005361616431413, 0.012732191427031, 0.012732191427031,
      0.012732191427031, 0.029707048808635, 0.029707048808635, 0.029707048808635, 0.026709487358142,
      0.026709487358142, 0.026709487358142, 0.031691197689589, 0.031691197689589, 0.031691197689589,
@@ -1127,7 +1132,7 @@ static const std::array<double, 138> cub2D_26_weights_data = {
      0.025102184615930, 0.025102184615930, 0.025102184615930}};
 
 // For cub2D_27: 145 points (145*3 = 435 elements)
-static const std::array<double, 145 * 2> cub2D_27_nodes_data = {
+constexpr std::array<double, 145 * 2> cub2D_27_nodes_data = {
     {-0.333333333333333, -0.333333333333333, -0.029244446609137, -0.029244446609137,
      -0.941511106781726, -0.029244446609137, -0.029244446609137, -0.941511106781726,
      -0.132843721814340, -0.132843721814340, -0.734312556371321, -0.132843721814340,
@@ -1201,7 +1206,7 @@ static const std::array<double, 145 * 2> cub2D_27_nodes_data = {
      -0.019508133770036, -0.350831684137242, -0.629660182092722, -0.019508133770036,
      -0.019508133770036, -0.629660182092722, -0.629660182092722, -0.350831684137242,
      -0.350831684137242, -0.629660182092722}};
-static const std::array<double, 145> cub2D_27_weights_data = {
+constexpr std::array<double, 145> cub2D_27_weights_data = {
     {0.029215421142604, 0.013615273717612, 0.013615273717612, 0.013615273717612,
      0.030951102870660, 0.030951102870660, 0.030951102870660, 0.031733186724762,
      0.031733186724762, 0.031733186724762, 0.031559855928489, 0.031559855928489,
@@ -1241,7 +1246,7 @@ static const std::array<double, 145> cub2D_27_weights_data = {
      0.028977845006028}};
 
 // For cub2D_28: 225 points (225*3 = 675 elements)
-static const std::array<double, 225 * 2> cub2D_28_nodes_data = {
+constexpr std::array<double, 225 * 2> cub2D_28_nodes_data = {
     {-0.988064607832230, 0.987992518020485,  -0.937649986705898, 0.937273392400706,
      -0.849117911767581, 0.848206583410427,  -0.726072255922453, 0.724417731360170,
      -0.573547944561595, 0.570972172608539,  -0.397788705468703, 0.394151347077563,
@@ -1355,7 +1360,7 @@ static const std::array<double, 225 * 2> cub2D_28_nodes_data = {
      -0.990568289973542, -0.570972172608539, -0.989647042582769, -0.724417731360170,
      -0.988903846377640, -0.848206583410427, -0.988369112325678, -0.937273392400706,
      -0.988064607832230, -0.987992518020485}};
-static const std::array<double, 225> cub2D_28_weights_data = {
+constexpr std::array<double, 225> cub2D_28_weights_data = {
     {0.000005678109445, 0.000067869690329, 0.000250117104238, 0.000591434111178,
      0.001096877668021, 0.001734258212849, 0.002437321168702, 0.003114968848543,
      0.003665090319212, 0.003990796070869, 0.004016439454972, 0.003700816722647,
@@ -1413,175 +1418,207 @@ static const std::array<double, 225> cub2D_28_weights_data = {
      0.002437321168702, 0.003114968848543, 0.003665090319212, 0.003990796070869,
      0.004016439454972, 0.003700816722647, 0.003045376334904, 0.002096114396383,
      0.000940083783827}};
-}  // namespace
 
-namespace oiseau::utils::integration {
-std::pair<xt::xarray<double>, xt::xarray<double>> cubature(int order) {
-  if (order <= 0) {
-    throw std::out_of_range("cubature: n must be a positive integer, but got " +
-                            std::to_string(order));
-  }
-  switch (order) {
-  case 1:
-    return std::pair{xt::adapt(cub2D_1_nodes_data.data(), {1ul, 2ul}),
-                     xt::adapt(cub2D_1_weights_data.data(), {1ul})};
-  case 2:
-    return std::pair{xt::adapt(cub2D_2_nodes_data.data(), {3ul, 2ul}),
-                     xt::adapt(cub2D_2_weights_data.data(), {3ul})};
-  case 3:
-    return std::pair{xt::adapt(cub2D_3_nodes_data.data(), {6ul, 2ul}),
-                     xt::adapt(cub2D_3_weights_data.data(), {6ul})};
-  case 4:
-    return std::pair{xt::adapt(cub2D_4_nodes_data.data(), {6ul, 2ul}),
-                     xt::adapt(cub2D_4_weights_data.data(), {6ul})};
-  case 5:
-    return std::pair{xt::adapt(cub2D_5_nodes_data.data(), {7ul, 2ul}),
-                     xt::adapt(cub2D_5_weights_data.data(), {7ul})};
-  case 6:
-    return std::pair{xt::adapt(cub2D_6_nodes_data.data(), {12ul, 2ul}),
-                     xt::adapt(cub2D_6_weights_data.data(), {12ul})};
-  case 7:
-    return std::pair{xt::adapt(cub2D_7_nodes_data.data(), {15ul, 2ul}),
-                     xt::adapt(cub2D_7_weights_data.data(), {15ul})};
-  case 8:
-    return std::pair{xt::adapt(cub2D_8_nodes_data.data(), {16ul, 2ul}),
-                     xt::adapt(cub2D_8_weights_data.data(), {16ul})};
-  case 9:
-    return std::pair{xt::adapt(cub2D_9_nodes_data.data(), {19ul, 2ul}),
-                     xt::adapt(cub2D_9_weights_data.data(), {19ul})};
-  case 10:
-    return std::pair{xt::adapt(cub2D_10_nodes_data.data(), {25ul, 2ul}),
-                     xt::adapt(cub2D_10_weights_data.data(), {25ul})};
-  case 11:
-    return std::pair{xt::adapt(cub2D_11_nodes_data.data(), {28ul, 2ul}),
-                     xt::adapt(cub2D_11_weights_data.data(), {28ul})};
-  case 12:
-    return std::pair{xt::adapt(cub2D_12_nodes_data.data(), {36ul, 2ul}),
-                     xt::adapt(cub2D_12_weights_data.data(), {36ul})};
-  case 13:
-    return std::pair{xt::adapt(cub2D_13_nodes_data.data(), {40ul, 2ul}),
-                     xt::adapt(cub2D_13_weights_data.data(), {40ul})};
-  case 14:
-    return std::pair{xt::adapt(cub2D_14_nodes_data.data(), {46ul, 2ul}),
-                     xt::adapt(cub2D_14_weights_data.data(), {46ul})};
-  case 15:
-    return std::pair{xt::adapt(cub2D_15_nodes_data.data(), {54ul, 2ul}),
-                     xt::adapt(cub2D_15_weights_data.data(), {54ul})};
-  case 16:
-    return std::pair{xt::adapt(cub2D_16_nodes_data.data(), {58ul, 2ul}),
-                     xt::adapt(cub2D_16_weights_data.data(), {58ul})};
-  case 17:
-    return std::pair{xt::adapt(cub2D_17_nodes_data.data(), {66ul, 2ul}),
-                     xt::adapt(cub2D_17_weights_data.data(), {66ul})};
-  case 18:
-    return std::pair{xt::adapt(cub2D_18_nodes_data.data(), {73ul, 2ul}),
-                     xt::adapt(cub2D_18_weights_data.data(), {73ul})};
-  case 19:
-    return std::pair{xt::adapt(cub2D_19_nodes_data.data(), {82ul, 2ul}),
-                     xt::adapt(cub2D_19_weights_data.data(), {82ul})};
-  case 20:
-    return std::pair{xt::adapt(cub2D_20_nodes_data.data(), {85ul, 2ul}),
-                     xt::adapt(cub2D_20_weights_data.data(), {85ul})};
-  case 21:
-    return std::pair{xt::adapt(cub2D_21_nodes_data.data(), {93ul, 2ul}),
-                     xt::adapt(cub2D_21_weights_data.data(), {93ul})};
-  case 22:
-    return std::pair{xt::adapt(cub2D_22_nodes_data.data(), {100ul, 2ul}),
-                     xt::adapt(cub2D_22_weights_data.data(), {100ul})};
-  case 23:
-    return std::pair{xt::adapt(cub2D_23_nodes_data.data(), {106ul, 2ul}),
-                     xt::adapt(cub2D_23_weights_data.data(), {106ul})};
-  case 24:
-    return std::pair{xt::adapt(cub2D_24_nodes_data.data(), {118ul, 2ul}),
-                     xt::adapt(cub2D_24_weights_data.data(), {118ul})};
-  case 25:
-    return std::pair{xt::adapt(cub2D_25_nodes_data.data(), {126ul, 2ul}),
-                     xt::adapt(cub2D_25_weights_data.data(), {126ul})};
-  case 26:
-    return std::pair{xt::adapt(cub2D_26_nodes_data.data(), {138ul, 2ul}),
-                     xt::adapt(cub2D_26_weights_data.data(), {138ul})};
-  case 27:
-    return std::pair{xt::adapt(cub2D_27_nodes_data.data(), {145ul, 2ul}),
-                     xt::adapt(cub2D_27_weights_data.data(), {145ul})};
-  case 28:
-    return std::pair{xt::adapt(cub2D_28_nodes_data.data(), {225ul, 2ul}),
-                     xt::adapt(cub2D_28_weights_data.data(), {225ul})};
-  default:
-    // TODO(tiagovla): check order/number of nodes relationship
-    int cubNA = std::ceil((order + 1) / 2);
-    auto [cubA, cubWA] = oiseau::dg::nodal::utils::jacobi_gq(cubNA - 1, 0, 0);
-    auto [cubB, cubWB] = oiseau::dg::nodal::utils::jacobi_gq(cubNA - 1, 1, 0);
-    auto r0 = xt::reshape_view(xt::tile(cubA, {cubNA}), {cubNA, cubNA});
-    auto r1 = xt::transpose(xt::reshape_view(xt::tile(cubB, {cubNA}), {cubNA, cubNA}));
-    xt::xarray<double> cubR = xt::flatten(xt::eval((0.5 * ((1.0 + r0) * (1.0 - r1)) - 1.0)));
-    xt::xarray<double> cubS = xt::flatten(xt::eval(r1));
-    xt::xarray<double> nodes = xt::stack(xt::xtuple(cubR, cubS), 1);
-    xt::xarray<double> weights = 0.5 * xt::flatten(xt::linalg::outer(cubWB, cubWA));
-    return std::pair{nodes, weights};
-  }
+struct TabulatedRule {
+  const double *nodes;
+  const double *weights;
+  std::size_t size;
+};
+
+template <std::size_t NodeSize, std::size_t Size>
+constexpr TabulatedRule make_rule(const std::array<double, NodeSize> &nodes,
+                                  const std::array<double, Size> &weights) {
+  static_assert(NodeSize == 2 * Size, "Cubature nodes must hold two coordinates per weight");
+  return {nodes.data(), weights.data(), Size};
 }
 
-std::pair<xt::xarray<double>, xt::xarray<double>> quadrature(int order) {
+// rule of order k at index k - 1
+constexpr std::array<TabulatedRule, 28> CUBATURE_TABLE = {{
+    make_rule(cub2D_1_nodes_data, cub2D_1_weights_data),
+    make_rule(cub2D_2_nodes_data, cub2D_2_weights_data),
+    make_rule(cub2D_3_nodes_data, cub2D_3_weights_data),
+    make_rule(cub2D_4_nodes_data, cub2D_4_weights_data),
+    make_rule(cub2D_5_nodes_data, cub2D_5_weights_data),
+    make_rule(cub2D_6_nodes_data, cub2D_6_weights_data),
+    make_rule(cub2D_7_nodes_data, cub2D_7_weights_data),
+    make_rule(cub2D_8_nodes_data, cub2D_8_weights_data),
+    make_rule(cub2D_9_nodes_data, cub2D_9_weights_data),
+    make_rule(cub2D_10_nodes_data, cub2D_10_weights_data),
+    make_rule(cub2D_11_nodes_data, cub2D_11_weights_data),
+    make_rule(cub2D_12_nodes_data, cub2D_12_weights_data),
+    make_rule(cub2D_13_nodes_data, cub2D_13_weights_data),
+    make_rule(cub2D_14_nodes_data, cub2D_14_weights_data),
+    make_rule(cub2D_15_nodes_data, cub2D_15_weights_data),
+    make_rule(cub2D_16_nodes_data, cub2D_16_weights_data),
+    make_rule(cub2D_17_nodes_data, cub2D_17_weights_data),
+    make_rule(cub2D_18_nodes_data, cub2D_18_weights_data),
+    make_rule(cub2D_19_nodes_data, cub2D_19_weights_data),
+    make_rule(cub2D_20_nodes_data, cub2D_20_weights_data),
+    make_rule(cub2D_21_nodes_data, cub2D_21_weights_data),
+    make_rule(cub2D_22_nodes_data, cub2D_22_weights_data),
+    make_rule(cub2D_23_nodes_data, cub2D_23_weights_data),
+    make_rule(cub2D_24_nodes_data, cub2D_24_weights_data),
+    make_rule(cub2D_25_nodes_data, cub2D_25_weights_data),
+    make_rule(cub2D_26_nodes_data, cub2D_26_weights_data),
+    make_rule(cub2D_27_nodes_data, cub2D_27_weights_data),
+    make_rule(cub2D_28_nodes_data, cub2D_28_weights_data),
+}};
+
+struct ComputedRule {
+  std::vector<double> nodes;
+  std::vector<double> weights;
+  std::size_t dim;
+};
+
+void check_order(const char *name, int order) {
   if (order <= 0) {
-    throw std::out_of_range("quadrature: n must be a positive integer, but got " +
+    throw std::out_of_range(std::string(name) + ": n must be a positive integer, but got " +
                             std::to_string(order));
   }
+}
+
+// each rule family is built once per order; map nodes never move, so the views stay valid
+template <ComputedRule (*Make)(int)>
+oiseau::utils::integration::CubatureRule cached_rule(int order) {
+  static std::mutex mutex;
+  static std::map<int, ComputedRule> cache;
+  const auto &rule = oiseau::utils::cached(cache, mutex, order, [order] { return Make(order); });
+  return {rule.nodes, rule.weights, rule.dim};
+}
+
+// collapsed Gauss-Jacobi rule for the triangle orders above the table
+ComputedRule collapsed_rule(int order) {
   // TODO(tiagovla): check order/number of nodes relationship
-  int n = std::ceil((order + 1) / 2);
+  int cubNA = std::ceil((order + 1) / 2);
+  auto [cubA, cubWA] = oiseau::dg::nodal::utils::jacobi_gq(cubNA - 1, 0, 0);
+  auto [cubB, cubWB] = oiseau::dg::nodal::utils::jacobi_gq(cubNA - 1, 1, 0);
+  auto r0 = xt::reshape_view(xt::tile(cubA, {cubNA}), {cubNA, cubNA});
+  auto r1 = xt::transpose(xt::reshape_view(xt::tile(cubB, {cubNA}), {cubNA, cubNA}));
+  xt::xarray<double> cubR = xt::flatten(xt::eval((0.5 * ((1.0 + r0) * (1.0 - r1)) - 1.0)));
+  xt::xarray<double> cubS = xt::flatten(xt::eval(r1));
+  xt::xarray<double> nodes = xt::stack(xt::xtuple(cubR, cubS), 1);
+  xt::xarray<double> weights = 0.5 * xt::flatten(xt::linalg::outer(cubWB, cubWA));
+  return {{nodes.begin(), nodes.end()}, {weights.begin(), weights.end()}, 2};
+}
+
+// highest order whose Grundmann-Moller rule stays accurate to about 1e-12; above it the
+// negative weights cancel badly and the collapsed rule, with positive weights, takes over
+constexpr int GRUNDMANN_MOLLER_MAX_ORDER = 13;
+
+// Grundmann, A. and Moller, H. M. "Invariant Integration Formulas for the n-Simplex by
+// Combinatorial Methods." SIAM J. Numer. Anal. 15(2), 282-290, 1978.
+//
+// Degree 2s + 1 from barycentric points (2 beta + 1) / (d + 3 - 2i), |beta| = s - i.
+ComputedRule grundmann_moller_rule(int order) {
+  const int s = order / 2;
+  const int d = 2 * s + 1;
+  ComputedRule rule{{}, {}, 3};
+  for (int i = 0; i <= s; i++) {
+    const int m = s - i;
+    const double denominator = d + 3 - 2 * i;
+    // the reference tetrahedron is 8 times the unit simplex
+    const double weight = (i % 2 ? -8.0 : 8.0) * std::ldexp(1.0, -2 * s) *
+                          std::pow(denominator, d) /
+                          (std::tgamma(i + 1.0) * std::tgamma(d + 4.0 - i));
+    for (int b1 = 0; b1 <= m; b1++) {
+      for (int b2 = 0; b1 + b2 <= m; b2++) {
+        for (int b3 = 0; b1 + b2 + b3 <= m; b3++) {
+          for (int b : {b1, b2, b3}) rule.nodes.push_back(2.0 * (2 * b + 1) / denominator - 1.0);
+          rule.weights.push_back(weight);
+        }
+      }
+    }
+  }
+  return rule;
+}
 
-  // Recurrence coefficients for Legendre polynomials
-  xt::xarray<double> a = xt::zeros<double>({n});
-  xt::xarray<double> b = xt::zeros<double>({n - 1});
-  for (int i = 1; i < n; ++i) {
-    b[i - 1] = static_cast<double>(i) / std::sqrt(4.0 * i * i - 1.0);
+// collapsed Gauss-Jacobi rule on the tetrahedron, (order / 2 + 1)^3 points
+ComputedRule collapsed_tetrahedron_rule(int order) {
+  const unsigned n = order / 2 + 1;
+  auto [a, wa] = oiseau::utils::integration::jacobi_gq(n - 1, 0, 0);
+  auto [b, wb] = oiseau::utils::integration::jacobi_gq(n - 1, 1, 0);
+  auto [c, wc] = oiseau::utils::integration::jacobi_gq(n - 1, 2, 0);
+  ComputedRule rule{{}, {}, 3};
+  for (unsigned k = 0; k < n; k++) {
+    for (unsigned j = 0; j < n; j++) {
+      for (unsigned i = 0; i < n; i++) {
+        rule.nodes.push_back(0.25 * (1.0 + a(i)) * (1.0 - b(j)) * (1.0 - c(k)) - 1.0);
+        rule.nodes.push_back(0.5 * (1.0 + b(j)) * (1.0 - c(k)) - 1.0);
+        rule.nodes.push_back(c(k));
+        rule.weights.push_back(0.125 * wa(i) * wb(j) * wc(k));
+      }
+    }
   }
+  return rule;
+}
+
+ComputedRule tetrahedron_rule(int order) {
+  return order <= GRUNDMANN_MOLLER_MAX_ORDER ? grundmann_moller_rule(order)
+                                              : collapsed_tetrahedron_rule(order);
+}
 
-  // Jacobi matrix construction
-  xt::xarray<double> J = xt::zeros<double>({n, n});
-  for (int i = 0; i < n; ++i) {
-    J(i, i) = a[i];
-    if (i < n - 1) {
-      J(i, i + 1) = b[i];
-      J(i + 1, i) = b[i];
+// tensor Gauss-Legendre rule, (order / 2 + 1)^3 points with r running fastest
+ComputedRule hexahedron_rule(int order) {
+  const unsigned n = order / 2 + 1;
+  auto [x, w] = oiseau::utils::integration::jacobi_gq(n - 1, 0, 0);
+  ComputedRule rule{{}, {}, 3};
+  for (unsigned k = 0; k < n; k++) {
+    for (unsigned j = 0; j < n; j++) {
+      for (unsigned i = 0; i < n; i++) {
+        rule.nodes.insert(rule.nodes.end(), {x(i), x(j), x(k)});
+        rule.weights.push_back(w(i) * w(j) * w(k));
+      }
     }
   }
+  return rule;
+}
+
+}  // namespace
 
-  // Solve eigenvalue problem
-  auto eig_result = xt::linalg::eig(J);
-  xt::xarray<double> eigenvalues = xt::real(std::get<0>(eig_result));
-  xt::xarray<double> eigenvectors = xt::real(std::get<1>(eig_result));
-  xt::xarray<std::size_t> sorted_indices = xt::argsort(eigenvalues);
+namespace oiseau::utils::integration {
 
-  xt::xarray<double> nodes = xt::view(eigenvalues, xt::keep(sorted_indices));
-  xt::xarray<double> sorted_vectors = xt::view(eigenvectors, xt::all(), xt::keep(sorted_indices));
+CubatureRule cubature_rule(int order) {
+  check_order("cubature", order);
+  if (static_cast<std::size_t>(order) <= CUBATURE_TABLE.size()) {
+    const auto &rule = CUBATURE_TABLE[order - 1];
+    return {{rule.nodes, 2 * rule.size}, {rule.weights, rule.size}};
+  }
+  return cached_rule<collapsed_rule>(order);
+}
 
-  // // Weights are 2 * (first row of eigenvectors)^2
-  xt::xarray<double> weights = 2.0 * xt::square(xt::row(sorted_vectors, 0));
+CubatureRule tetrahedron_cubature_rule(int order) {
+  check_order("tetrahedron_cubature", order);
+  return cached_rule<tetrahedron_rule>(order);
+}
 
+CubatureRule hexahedron_cubature_rule(int order) {
+  check_order("hexahedron_cubature", order);
+  return cached_rule<hexahedron_rule>(order);
+}
+
+std::pair<xt::xarray<double>, xt::xarray<double>> cubature(int order) {
+  auto rule = cubature_rule(order);
+  return std::pair{xt::xarray<double>(rule.nodes_view()),
+                   xt::xarray<double>(rule.weights_view())};
+}
+
+std::pair<xt::xarray<double>, xt::xarray<double>> quadrature(int order) {
+  if (order <= 0) {
+    throw std::out_of_range("quadrature: n must be a positive integer, but got " +
+                            std::to_string(order));
+  }
+  // TODO(tiagovla): check order/number of nodes relationship
+  const std::vector<std::size_t> shape = {static_cast<std::size_t>((order + 1) / 2)};
+  xt::xarray<double> nodes = xt::zeros<double>(shape), weights = xt::zeros<double>(shape);
+  oiseau::utils::gauss_jacobi(0.0, 0.0, {nodes.data(), nodes.size()},
+                              {weights.data(), weights.size()});
   return std::make_pair(nodes, weights);
 }
 
 std::pair<xt::xarray<double>, xt::xarray<double>> jacobi_gq(unsigned n, double alpha, double beta) {
-  if (n == 0) {
-    xt::xarray<double> x = {(alpha - beta) / (alpha + beta + 2)};
-    xt::xarray<double> w = {2};
-    return make_pair(std::move(x), std::move(w));
-  }
-  xt::xarray<double> h1 = 2 * xt::linspace<double>(0, n, n + 1) + alpha + beta;
-  auto h1s = xt::view(h1, xt::range(0, n));
-  auto lins = xt::arange<double>(1, n + 1);
-  xt::xarray<double> m =
-      xt::diag(-1.0 / 2.0 * (std::pow(alpha, 2) - std::pow(beta, 2)) / (h1 + 2) / h1) +
-      xt::diag(2. / (h1s + 2) *
-                   xt::sqrt(lins * (lins + alpha + beta) * (lins + alpha) * (lins + beta) /
-                            (h1s + 1) / (h1s + 3)),
-               1);
-  if (alpha + beta == 0) m(0, 0) = 0;
-  m += xt::transpose(m);
-  auto [d, v] = xt::linalg::eigh(m);
-  double cte = std::pow(2, (alpha + beta + 1)) / (alpha + beta + 1) * std::tgamma(alpha + 1) *
-               std::tgamma(beta + 1) / std::tgamma(alpha + beta + 1);
-  xt::xarray<double> w = cte * xt::square(xt::view(v, 0, xt::all())), x = d;
+  const std::vector<std::size_t> shape = {n + 1};
+  xt::xarray<double> x = xt::zeros<double>(shape), w = xt::zeros<double>(shape);
+  oiseau::utils::gauss_jacobi(alpha, beta, {x.data(), x.size()}, {w.data(), w.size()});
   return {x, w};
 }
 
@@ -6,11 +6,54 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <span>
 #include <utility>
+#include <xtensor/containers/xadapt.hpp>
 #include <xtensor/containers/xarray.hpp>
 #include <xtensor/core/xtensor_forward.hpp>
 
 namespace oiseau::utils::integration {
+
+/**
+ * @brief Non-owning view of a cubature rule on a reference cell.
+ *
+ * `nodes` holds the `dim` coordinates of each point, point after point. Tabulated orders point
+ * into constexpr tables and the others into a cache filled on first use, so a rule stays valid
+ * for the whole program and can be requested from element loops and from several threads.
+ */
+struct CubatureRule {
+  std::span<const double> nodes;
+  std::span<const double> weights;
+  std::size_t dim = 2;
+
+  std::size_t size() const { return weights.size(); }
+  auto nodes_view() const {
+    return xt::adapt(nodes.data(), nodes.size(), xt::no_ownership(),
+                     std::array<std::size_t, 2>{size(), dim});
+  }
+  auto weights_view() const {
+    return xt::adapt(weights.data(), weights.size(), xt::no_ownership(),
+                     std::array<std::size_t, 1>{size()});
+  }
+};
+
+/// Rule on the reference triangle exact to degree `order`.
+CubatureRule cubature_rule(int order);
+
+/**
+ * @brief Rule on the reference tetrahedron exact to degree `order`.
+ *
+ * Grundmann-Moller rules, with C(order / 2 + 4, 4) points, up to order 13; collapsed
+ * Gauss-Jacobi rules with (order / 2 + 1)^3 positive weights above.
+ */
+CubatureRule tetrahedron_cubature_rule(int order);
+
+/// Tensor Gauss-Legendre rule on [-1, 1]^3, exact to degree `order` in each variable.
+CubatureRule hexahedron_cubature_rule(int order);
+
+/// Owning copy of `cubature_rule(order)`, as (n x 2) nodes and (n) weights.
 std::pair<xt::xarray<double>, xt::xarray<double>> cubature(int order);
 std::pair<xt::xarray<double>, xt::xarray<double>> quadrature(int order);
 std::pair<xt::xarray<double>, xt::xarray<double>> jacobi_gq(unsigned n, double alpha, double beta);
@@ -6,4 +6,92 @@
 
 #include "oiseau/utils/math.hpp"
 
-namespace oiseau::utils {}  // namespace oiseau::utils
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+
+namespace oiseau::utils {
+
+namespace {
+
+constexpr int MAX_NEWTON_ITERATIONS = 100;
+constexpr double NEWTON_TOL = 1e-15;
+
+struct OrthonormalJacobi {
+  double p;       // p_n(x)
+  double dp;      // p_n'(x)
+  double sum_sq;  // sum of p_k(x)^2 for k < n
+};
+
+// three-term recurrence of the orthonormal jacobi polynomials, as in Hesthaven & Warburton
+OrthonormalJacobi orthonormal_jacobi(unsigned n, double alpha, double beta, double x) {
+  const double ab = alpha + beta;
+  const double p0 = std::exp(0.5 * (std::lgamma(ab + 2) - std::lgamma(alpha + 1) -
+                                    std::lgamma(beta + 1) - (ab + 1) * std::numbers::ln2));
+  if (n == 0) return {p0, 0.0, 0.0};
+
+  const double c1 = std::sqrt((ab + 3) / ((alpha + 1) * (beta + 1)));
+  double p_prev = p0, dp_prev = 0.0;
+  double p = p0 * ((ab + 2) * x / 2 + (alpha - beta) / 2) * c1;
+  double dp = p0 * (ab + 2) / 2 * c1;
+  double sum_sq = p0 * p0;
+  double a_old = 2 / (ab + 2) * std::sqrt((alpha + 1) * (beta + 1) / (ab + 3));
+  for (unsigned i = 1; i < n; i++) {
+    const double h1 = 2 * i + ab;
+    const double a_new = 2 / (h1 + 2) *
+                         std::sqrt((i + 1) * (i + 1 + ab) * (i + 1 + alpha) * (i + 1 + beta) /
+                                   ((h1 + 1) * (h1 + 3)));
+    const double b_new = -(alpha * alpha - beta * beta) / (h1 * (h1 + 2));
+    const double p_next = ((x - b_new) * p - a_old * p_prev) / a_new;
+    const double dp_next = (p + (x - b_new) * dp - a_old * dp_prev) / a_new;
+    sum_sq += p * p;
+    p_prev = p;
+    dp_prev = dp;
+    p = p_next;
+    dp = dp_next;
+    a_old = a_new;
+  }
+  return {p, dp, sum_sq};
+}
+
+}  // namespace
+
+void gauss_jacobi(double alpha, double beta, std::span<double> x, std::span<double> w) {
+  if (x.size() != w.size()) throw std::invalid_argument("Nodes and weights must have equal size");
+  if (!(alpha > -1.0 && beta > -1.0)) throw std::invalid_argument("alpha and beta must be > -1");
+  const std::size_t n = x.size();
+  const auto degree = static_cast<unsigned>(n);
+
+  for (std::size_t k = 0; k < n; k++) {
+    // the roots interlace with the chebyshev ones, so the midpoint keeps clear of x[k - 1]
+    double r = -std::cos((2.0 * k + 1.0) * std::numbers::pi / (2.0 * n));
+    if (k > 0) r = 0.5 * (r + x[k - 1]);
+    for (int it = 0; it < MAX_NEWTON_ITERATIONS; it++) {
+      const auto [p, dp, _] = orthonormal_jacobi(degree, alpha, beta, r);
+      double deflation = 0.0;
+      for (std::size_t j = 0; j < k; j++) deflation += 1.0 / (r - x[j]);
+      const double delta = -p / (dp - deflation * p);
+      r += delta;
+      if (std::abs(delta) < NEWTON_TOL) break;
+    }
+    x[k] = r;
+    w[k] = 1.0 / orthonormal_jacobi(degree, alpha, beta, r).sum_sq;
+  }
+
+  // the guesses are only roughly ordered for skewed weights, e.g. alpha = 5, beta = 0; the
+  // roots come out nearly sorted, so an insertion sort is cheap and keeps the rule allocation-free
+  for (std::size_t k = 1; k < n; k++) {
+    const double xk = x[k], wk = w[k];
+    std::size_t j = k;
+    for (; j > 0 && x[j - 1] > xk; j--) {
+      x[j] = x[j - 1];
+      w[j] = w[j - 1];
+    }
+    x[j] = xk;
+    w[j] = wk;
+  }
+}
+
+}  // namespace oiseau::utils
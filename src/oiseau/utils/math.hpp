@@ -11,6 +11,7 @@
 #include <concepts>
 #include <limits>
 #include <ranges>
+#include <span>
 #include <xtensor/containers/xarray.hpp>
 
 namespace oiseau::utils {
@@ -76,4 +77,19 @@ Container grad_jacobi_p(int n, Real alpha, Real beta, const Container& input) {
   return output;
 }
 
+/**
+ * @brief Gauss-Jacobi nodes and weights for the weight (1 - x)^alpha (1 + x)^beta on [-1, 1].
+ *
+ * The rule has `x.size()` points and is written in ascending order into the caller's buffers.
+ * Each root of the orthonormal P_n^{(alpha,beta)} is polished by Newton's method from a
+ * Chebyshev guess, deflating the roots already found, and its weight is the Christoffel number
+ * 1 / sum_k p_k(x)^2. The cost is O(n^2) and nothing is allocated.
+ *
+ * @param alpha parameter of the jacobi polynomial, > -1
+ * @param beta parameter of the jacobi polynomial, > -1
+ * @param x output nodes
+ * @param w output weights, of the same size as `x`
+ */
+void gauss_jacobi(double alpha, double beta, std::span<double> x, std::span<double> w);
+
 }  // namespace oiseau::utils
@@ -0,0 +1,82 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/core/xmath.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+#include <xtensor/misc/xmanipulation.hpp>
+
+#include "oiseau/dg/nodal/dealiasing.hpp"
+#include "oiseau/dg/nodal/operators.hpp"
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/test_macros.hpp"
+
+using namespace oiseau::dg::nodal;
+
+namespace {
+
+constexpr RefElementType types[] = {RefElementType::Line, RefElementType::Triangle,
+                                    RefElementType::Quadrilateral, RefElementType::Tetrahedron,
+                                    RefElementType::Hexahedron};
+
+}  // namespace
+
+TEST(test_dealiasing, projection_inverts_interpolation) {
+  for (auto type : types) {
+    const auto& ops = cubature_operators(type, 3, 6);
+    auto identity = xt::flatten(xt::linalg::dot(ops.projection, ops.interpolation));
+    auto expected = xt::flatten(xt::eye<double>(ops.projection.shape()[0]));
+    EXPECT_FLOATS_NEARLY_EQ(identity, expected, 1e-10);
+  }
+}
+
+TEST(test_dealiasing, weak_derivative_matches_stiffness) {
+  // M W_k I g = (g, d l_i / d r_k) = S_k^T g for g in the element space
+  for (auto type : types) {
+    const auto& ops = cubature_operators(type, 2, 4);
+    const auto& ref_ops = ref_operators(type, 2);
+    xt::xarray<double> g = xt::linspace<double>(-1.0, 2.0, ops.interpolation.shape()[1]);
+    for (std::size_t k = 0; k < ops.weak_derivative.size(); ++k) {
+      xt::xarray<double> at_points = xt::linalg::dot(ops.interpolation, g);
+      xt::xarray<double> weak =
+          xt::linalg::dot(ref_ops.mass, xt::linalg::dot(ops.weak_derivative[k], at_points));
+      xt::xarray<double> expected = xt::linalg::dot(xt::transpose(ref_ops.stiffness[k]), g);
+      EXPECT_FLOATS_NEARLY_EQ(weak, expected, 1e-10);
+    }
+  }
+}
+
+TEST(test_dealiasing, project_pointwise_over_blocks) {
+  const auto& ops = cubature_operators(RefElementType::Triangle, 2, 6);
+  const auto& ref_ops = ref_operators(RefElementType::Triangle, 2);
+  const std::size_t np = ops.interpolation.shape()[1];
+  std::vector<double> u(3 * np), v(3 * np), work;
+  for (std::size_t i = 0; i < u.size(); ++i) u[i] = 0.1 * static_cast<double>(i % 7) - 0.2;
+
+  auto square = [](std::span<double> values) {
+    for (auto& x : values) x *= x;
+  };
+  project_pointwise(ops, u, v, square, work);
+  EXPECT_EQ(work.size(), 3 * ops.interpolation.shape()[0]);
+
+  // the mean of u^2 is kept exactly: 1^T M v = sum_q w_q u(x_q)^2
+  for (std::size_t e = 0; e < 3; ++e) {
+    xt::xarray<double> ue = xt::zeros<double>({np});
+    xt::xarray<double> ve = xt::zeros<double>({np});
+    for (std::size_t i = 0; i < np; ++i) {
+      ue(i) = u[e * np + i];
+      ve(i) = v[e * np + i];
+    }
+    auto uq = xt::linalg::dot(ops.interpolation, ue);
+    const double exact = xt::sum(ops.weights * uq * uq)();
+    EXPECT_NEAR(xt::sum(xt::linalg::dot(ref_ops.mass, ve))(), exact, 1e-12);
+  }
+}
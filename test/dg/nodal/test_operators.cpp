@@ -0,0 +1,91 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/core/xmath.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+#include <xtensor/misc/xmanipulation.hpp>
+#include <xtensor/views/xview.hpp>
+
+#include "oiseau/dg/nodal/operators.hpp"
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/test_macros.hpp"
+
+using namespace oiseau::dg::nodal;
+
+namespace {
+
+struct Case {
+  RefElementType type;
+  double volume;
+  double boundary;
+};
+
+// reference volume, and total face measure in reference face units
+constexpr Case cases[] = {
+    {RefElementType::Line, 2.0, 2.0},          {RefElementType::Triangle, 2.0, 6.0},
+    {RefElementType::Quadrilateral, 4.0, 8.0}, {RefElementType::Tetrahedron, 4.0 / 3.0, 8.0},
+    {RefElementType::Hexahedron, 8.0, 24.0},
+};
+
+}  // namespace
+
+TEST(test_operators, mass_and_cholesky) {
+  for (const auto& c : cases) {
+    for (unsigned order = 1; order <= 3; ++order) {
+      const auto& ops = ref_operators(c.type, order);
+      EXPECT_NEAR(xt::sum(ops.mass)(), c.volume, 1e-10);
+      auto llt = xt::linalg::dot(ops.mass_cholesky, xt::transpose(ops.mass_cholesky));
+      auto flat = xt::flatten(llt);
+      auto expected = xt::flatten(ops.mass);
+      EXPECT_FLOATS_NEARLY_EQ(flat, expected, 1e-10);
+    }
+  }
+}
+
+TEST(test_operators, stiffness_annihilates_constants) {
+  for (const auto& c : cases) {
+    const auto& ops = ref_operators(c.type, 3);
+    for (const auto& s : ops.stiffness) {
+      EXPECT_NEAR(xt::amax(xt::abs(xt::sum(s, {1})))(), 0.0, 1e-10);
+    }
+  }
+}
+
+TEST(test_operators, lift_integrates_face_data) {
+  for (const auto& c : cases) {
+    const auto& ops = ref_operators(c.type, 2);
+    EXPECT_EQ(ops.face_nodes.size(), ops.face_mass.size());
+    EXPECT_NEAR(xt::sum(xt::linalg::dot(ops.mass, ops.lift))(), c.boundary, 1e-10);
+  }
+}
+
+TEST(test_operators, cached) {
+  const auto& a = ref_operators(RefElementType::Triangle, 2);
+  EXPECT_EQ(&a, &ref_operators(RefElementType::Triangle, 2));
+}
+
+TEST(test_operators, affine_element_scaling) {
+  xt::xarray<double> vertices = {{0.0, 0.0, 0.0}, {2.0, 0.0, 0.0}, {0.0, 1.0, 0.0}};
+  auto jacobian = affine_jacobian(RefElementType::Triangle, vertices);
+  EXPECT_NEAR(xt::linalg::det(jacobian), 0.5, 1e-14);
+
+  const auto& ops = ref_operators(RefElementType::Triangle, 2);
+  EXPECT_NEAR(xt::sum(element_mass(ops, jacobian))(), 1.0, 1e-10);
+  auto identity = xt::linalg::dot(element_mass(ops, jacobian), element_inv_mass(ops, jacobian));
+  auto flat = xt::flatten(identity);
+  auto expected = xt::flatten(xt::eye<double>(ops.mass.shape()[0]));
+  EXPECT_FLOATS_NEARLY_EQ(flat, expected, 1e-10);
+
+  // (1, d x / d x) over the cell is the integral of 1, i.e. its area
+  auto sx = element_stiffness(ops, jacobian, 0);
+  auto r = get_ref_element(RefElementType::Triangle, 2)->r();
+  xt::xarray<double> x = xt::col(r, 0) + 1.0;
+  EXPECT_NEAR(xt::sum(xt::linalg::dot(sx, x))(), 1.0, 1e-10);
+}
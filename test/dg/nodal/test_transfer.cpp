@@ -0,0 +1,82 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/core/xeval.hpp>
+#include <xtensor/core/xmath.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+#include <xtensor/misc/xmanipulation.hpp>
+#include <xtensor/views/xview.hpp>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/dg/nodal/transfer.hpp"
+#include "oiseau/test_macros.hpp"
+
+using namespace oiseau::dg::nodal;
+
+TEST(test_transfer, raise_then_lower_is_identity) {
+  for (auto type : {RefElementType::Triangle, RefElementType::Quadrilateral}) {
+    for (unsigned order = 1; order <= 4; ++order) {
+      auto round_trip = xt::linalg::dot(transfer_matrix(type, order + 2, order),
+                                        transfer_matrix(type, order, order + 2));
+      auto identity = xt::eye<double>(get_ref_element(type, order)->number_of_nodes());
+      auto flat = xt::flatten(round_trip);
+      auto expected = xt::flatten(identity);
+      EXPECT_FLOATS_NEARLY_EQ(flat, expected, 1e-10);
+    }
+  }
+}
+
+TEST(test_transfer, lowering_keeps_low_order_polynomials) {
+  for (auto type : {RefElementType::Triangle, RefElementType::Quadrilateral}) {
+    auto low = get_ref_element(type, 2);
+    auto high = get_ref_element(type, 5);
+
+    // f(r, s) = r² + r s - s, which the order 2 space represents exactly
+    auto f = [](const auto& rs) {
+      auto r = xt::col(rs, 0);
+      auto s = xt::col(rs, 1);
+      return xt::eval(xt::pow(r, 2) + r * s - s);
+    };
+    auto exact = f(low->r());
+    for (auto kind : {TransferKind::Interpolation, TransferKind::Projection}) {
+      auto lowered = xt::linalg::dot(transfer_matrix(type, 5, 2, kind), f(high->r()));
+      EXPECT_FLOATS_NEARLY_EQ(lowered, exact, 1e-10);
+    }
+  }
+}
+
+TEST(test_transfer, matrices_are_cached) {
+  const auto& a = transfer_matrix(RefElementType::Triangle, 3, 1);
+  const auto& b = transfer_matrix(RefElementType::Triangle, 3, 1);
+  EXPECT_EQ(&a, &b);
+  EXPECT_NE(&a, &transfer_matrix(RefElementType::Triangle, 3, 1, TransferKind::Interpolation));
+}
+
+TEST(test_transfer, apply_blocks_matches_per_block_products) {
+  auto ref = get_ref_element(RefElementType::Triangle, 2);
+  xt::xarray<double> points = {{-1.0, -1.0}, {0.0, -0.5}, {-0.25, 0.25}};
+  auto op = interpolation_matrix(*ref, points);
+  ASSERT_EQ(op.shape()[0], 3);
+  ASSERT_EQ(op.shape()[1], ref->number_of_nodes());
+
+  const std::size_t np = ref->number_of_nodes();
+  std::vector<double> u(4 * np);
+  for (std::size_t i = 0; i < u.size(); ++i) u[i] = 0.5 * i - 1.0;
+  std::vector<double> v(4 * 3);
+  apply_blocks(op, u, v);
+  for (std::size_t b = 0; b < 4; ++b) {
+    for (std::size_t p = 0; p < 3; ++p) {
+      double expected = 0.0;
+      for (std::size_t k = 0; k < np; ++k) expected += op(p, k) * u[b * np + k];
+      EXPECT_NEAR(v[b * 3 + p], expected, 1e-12);
+    }
+  }
+}
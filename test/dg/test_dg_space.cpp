@@ -0,0 +1,297 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "oiseau/dg/dg_space.hpp"
+#include "oiseau/dg/nodal/transfer.hpp"
+#include "oiseau/mesh/adapt.hpp"
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/test_macros.hpp"
+#include "oiseau/test_meshes.hpp"
+
+using namespace oiseau;
+
+namespace {
+
+double quadratic(double x, double y) { return x * x - 2.0 * x * y + 0.5 * y - 1.0; }
+
+// nodal values of f(x, y) in the layout of `space`
+template <class F>
+std::vector<double> sample(const dg::DGSpace& space, F f) {
+  std::vector<double> u(space.n_dofs());
+  for (std::size_t i = 0; i < space.elements().size(); ++i) {
+    const auto& x = space.elements()[i].nodes();
+    for (std::size_t j = 0; j < x.shape()[0]; ++j) u[space.offsets()[i] + j] = f(x(j, 0), x(j, 1));
+  }
+  return u;
+}
+
+void expect_consistent_offsets(const dg::DGSpace& space) {
+  const auto offsets = space.offsets();
+  ASSERT_EQ(offsets.size(), space.elements().size() + 1);
+  EXPECT_EQ(offsets.front(), 0);
+  for (std::size_t i = 0; i < space.elements().size(); ++i) {
+    const auto& element = space.elements()[i];
+    EXPECT_EQ(element.order(), space.orders()[i]);
+    EXPECT_EQ(offsets[i + 1] - offsets[i], element.reference().number_of_nodes());
+    EXPECT_EQ(element.nodes().shape()[0], element.reference().number_of_nodes());
+  }
+  EXPECT_EQ(space.n_dofs(), offsets.back());
+}
+
+}  // namespace
+
+TEST(test_dg_space, quadrilateral_nodes_follow_mesh_vertices) {
+  // a non-parallelogram cell, so a twisted vertex map cannot land on the right nodes
+  const std::vector<double> x = {0.0, 0.0, 2.0, 0.0, 2.5, 1.5, 0.5, 1.0};
+  std::vector<mesh::CellType> cell_types = {mesh::get_cell_type(mesh::CellKind::Quadrilateral)};
+  mesh::Mesh m(mesh::Topology({{0, 1, 2, 3}}, std::move(cell_types)),
+               mesh::Geometry(std::vector<double>(x), 2));
+
+  for (unsigned order : {1u, 3u}) {
+    dg::DGSpace space(m, {order});
+    const auto& element = space.elements()[0];
+    const auto& r = element.reference().r();
+    const auto& nodes = element.nodes();
+    for (std::size_t i = 0; i < r.shape()[0]; ++i) {
+      // bilinear map over the counter-clockwise mesh vertices
+      const double a = r(i, 0), b = r(i, 1);
+      const std::array<double, 4> shape = {(1 - a) * (1 - b) / 4, (1 + a) * (1 - b) / 4,
+                                           (1 + a) * (1 + b) / 4, (1 - a) * (1 + b) / 4};
+      for (std::size_t k = 0; k < 2; ++k) {
+        double expected = 0.0;
+        for (std::size_t v = 0; v < 4; ++v) expected += shape[v] * x[2 * v + k];
+        EXPECT_NEAR(nodes(i, k), expected, 1e-12) << "order " << order << ", node " << i;
+      }
+    }
+  }
+}
+
+TEST(test_dg_space, set_orders_round_trip) {
+  for (auto kind : {mesh::CellKind::Triangle, mesh::CellKind::Quadrilateral}) {
+    auto m = test::grid_mesh(kind, 3);
+    const std::size_t n_cells = m.topology().n_cells();
+    dg::DGSpace space(m, std::vector<unsigned>(n_cells, 2));
+    const std::size_t np2 = space.elements()[0].reference().number_of_nodes();
+    const auto u = sample(space, quadratic);
+
+    const std::vector<std::size_t> cells = {0, 4, 7};
+    const auto raised = space.set_orders(cells, std::vector<unsigned>{4, 3, 4}, u);
+    EXPECT_EQ(space.orders()[0], 4);
+    EXPECT_EQ(space.orders()[4], 3);
+    EXPECT_EQ(space.orders()[1], 2);
+    expect_consistent_offsets(space);
+    EXPECT_GT(space.n_dofs(), n_cells * np2);
+    // the quadratic is carried exactly into the richer elements
+    const auto expected = sample(space, quadratic);
+    EXPECT_FLOATS_NEARLY_EQ(raised, expected, 1e-10);
+
+    const auto lowered = space.set_orders(cells, std::vector<unsigned>{2, 2, 2}, raised);
+    expect_consistent_offsets(space);
+    EXPECT_EQ(space.n_dofs(), n_cells * np2);
+    EXPECT_FLOATS_NEARLY_EQ(lowered, u, 1e-10);
+  }
+}
+
+TEST(test_dg_space, set_orders_last_order_wins) {
+  auto m = test::grid_mesh(mesh::CellKind::Triangle, 2);
+  dg::DGSpace space(m, std::vector<unsigned>(m.topology().n_cells(), 1));
+  space.set_orders(std::vector<std::size_t>{1, 1}, std::vector<unsigned>{3, 2});
+  EXPECT_EQ(space.orders()[1], 2);
+  expect_consistent_offsets(space);
+}
+
+TEST(test_dg_space, set_orders_failure_leaves_space_untouched) {
+  auto m = test::grid_mesh(mesh::CellKind::Triangle, 2);
+  const std::size_t n_cells = m.topology().n_cells();
+  dg::DGSpace space(m, std::vector<unsigned>(n_cells, 2));
+  const std::vector<std::size_t> offsets(space.offsets().begin(), space.offsets().end());
+  const std::vector<unsigned> orders(space.orders().begin(), space.orders().end());
+  const auto u = sample(space, quadratic);
+
+  auto expect_unchanged = [&] {
+    EXPECT_EQ(std::vector<unsigned>(space.orders().begin(), space.orders().end()), orders);
+    EXPECT_EQ(std::vector<std::size_t>(space.offsets().begin(), space.offsets().end()), offsets);
+    expect_consistent_offsets(space);
+  };
+  EXPECT_THROW(space.set_orders(std::vector<std::size_t>{0, n_cells},
+                                std::vector<unsigned>{3, 3}),
+               std::out_of_range);
+  expect_unchanged();
+  EXPECT_THROW(space.set_orders(std::vector<std::size_t>{0, 1}, std::vector<unsigned>{3, 0}, u),
+               std::invalid_argument);
+  expect_unchanged();
+  EXPECT_THROW(space.set_orders(std::vector<std::size_t>{0, 1}, std::vector<unsigned>{3}),
+               std::invalid_argument);
+  expect_unchanged();
+  EXPECT_THROW(space.set_orders(std::vector<std::size_t>{0}, std::vector<unsigned>{3},
+                                std::vector<double>(u.size() - 1)),
+               std::invalid_argument);
+  expect_unchanged();
+}
+
+TEST(test_dg_space, transfer_matches_per_element_products) {
+  auto m = test::grid_mesh(mesh::CellKind::Triangle, 3);
+  const std::size_t n_cells = m.topology().n_cells();
+  std::vector<unsigned> from_orders(n_cells), to_orders(n_cells);
+  for (std::size_t i = 0; i < n_cells; ++i) {
+    from_orders[i] = 1 + i % 4;
+    to_orders[i] = 1 + (i * 7) % 5;
+  }
+  dg::DGSpace from(m, from_orders);
+  dg::DGSpace to(m, to_orders);
+  std::vector<double> u(from.n_dofs());
+  for (std::size_t k = 0; k < u.size(); ++k) u[k] = 0.25 * static_cast<double>(k % 11) - 1.0;
+
+  for (auto kind : {dg::nodal::TransferKind::Interpolation, dg::nodal::TransferKind::Projection}) {
+    const auto v = from.transfer(u, to, kind);
+    ASSERT_EQ(v.size(), to.n_dofs());
+    std::vector<double> expected(to.n_dofs());
+    for (std::size_t i = 0; i < n_cells; ++i) {
+      const auto type = from.elements()[i].reference().type();
+      const auto& op = dg::nodal::transfer_matrix(type, from_orders[i], to_orders[i], kind);
+      const std::size_t n_from = from.offsets()[i + 1] - from.offsets()[i];
+      const std::size_t n_to = to.offsets()[i + 1] - to.offsets()[i];
+      ASSERT_EQ(op.shape()[0], n_to);
+      ASSERT_EQ(op.shape()[1], n_from);
+      for (std::size_t p = 0; p < n_to; ++p) {
+        for (std::size_t q = 0; q < n_from; ++q) {
+          expected[to.offsets()[i] + p] += op(p, q) * u[from.offsets()[i] + q];
+        }
+      }
+    }
+    EXPECT_FLOATS_NEARLY_EQ(v, expected, 1e-12);
+  }
+}
+
+TEST(test_dg_space, set_orders_field_matches_transfer) {
+  auto m = test::grid_mesh(mesh::CellKind::Quadrilateral, 3);
+  const std::vector<unsigned> orders(m.topology().n_cells(), 3);
+  dg::DGSpace before(m, orders);
+  dg::DGSpace space(m, orders);
+  std::vector<double> u(space.n_dofs());
+  for (std::size_t k = 0; k < u.size(); ++k) u[k] = static_cast<double>(k % 7) - 3.0;
+
+  const std::vector<std::size_t> cells = {2, 5, 8};
+  const auto v = space.set_orders(cells, std::vector<unsigned>{1, 5, 2}, u);
+  const auto expected = before.transfer(u, space);
+  EXPECT_FLOATS_NEARLY_EQ(v, expected, 1e-10);
+}
+
+TEST(test_dg_space, transfer_rejects_mismatched_spaces) {
+  auto m = test::grid_mesh(mesh::CellKind::Triangle, 2);
+  const std::size_t n_cells = m.topology().n_cells();
+  dg::DGSpace space(m, std::vector<unsigned>(n_cells, 2));
+  const std::vector<double> u(space.n_dofs(), 1.0);
+
+  EXPECT_THROW(space.transfer(std::vector<double>(u.size() + 1), space), std::invalid_argument);
+
+  auto coarse = test::grid_mesh(mesh::CellKind::Triangle, 1);
+  dg::DGSpace other_cells(coarse, std::vector<unsigned>(coarse.topology().n_cells(), 2));
+  EXPECT_THROW(space.transfer(u, other_cells), std::invalid_argument);
+
+  // as many quadrilaterals as there are triangles
+  std::vector<double> x;
+  std::vector<std::vector<std::size_t>> conn;
+  for (std::size_t i = 0; i <= n_cells; ++i) {
+    x.insert(x.end(), {static_cast<double>(i), 0.0, static_cast<double>(i), 1.0});
+    if (i < n_cells) conn.push_back({2 * i, 2 * i + 2, 2 * i + 3, 2 * i + 1});
+  }
+  std::vector<mesh::CellType> cell_types(n_cells,
+                                         mesh::get_cell_type(mesh::CellKind::Quadrilateral));
+  mesh::Mesh strip(mesh::Topology(std::move(conn), std::move(cell_types)),
+                   mesh::Geometry(std::move(x), 2));
+  dg::DGSpace quads(strip, std::vector<unsigned>(n_cells, 2));
+  EXPECT_THROW(space.transfer(u, quads), std::invalid_argument);
+}
+
+TEST(test_dg_space, update_follows_refinement_and_coarsening) {
+  for (auto kind : {mesh::CellKind::Triangle, mesh::CellKind::Quadrilateral}) {
+    mesh::AdaptiveMesh adaptive(test::grid_mesh(kind, 2));
+    const std::size_t n_cells = adaptive.mesh().topology().n_cells();
+    std::vector<unsigned> orders(n_cells);
+    for (std::size_t i = 0; i < n_cells; ++i) orders[i] = 1 + i % 3;
+    dg::DGSpace space(adaptive.mesh(), orders);
+
+    // kept elements are moved into place, so their node storage does not change
+    auto check = [&](const mesh::AdaptChange& change, const std::vector<unsigned>& old_orders,
+                     const std::vector<const double*>& old_nodes) {
+      ASSERT_EQ(space.elements().size(), change.origin.size());
+      for (std::size_t i = 0; i < change.origin.size(); ++i) {
+        const auto& sources = change.sources[i];
+        unsigned expected = 0;
+        for (auto c : sources) expected = std::max(expected, old_orders[c]);
+        EXPECT_EQ(space.orders()[i], expected);
+        if (change.origin[i] == mesh::CellOrigin::Kept) {
+          EXPECT_EQ(space.elements()[i].nodes().data(), old_nodes[sources.front()]);
+        }
+      }
+      expect_consistent_offsets(space);
+    };
+    auto snapshot = [&] {
+      std::vector<const double*> nodes;
+      for (const auto& element : space.elements()) nodes.push_back(element.nodes().data());
+      return std::pair{std::vector<unsigned>(space.orders().begin(), space.orders().end()),
+                       nodes};
+    };
+
+    auto [orders_0, nodes_0] = snapshot();
+    auto refined = adaptive.refine(std::vector<std::size_t>{1});
+    space.update(refined);
+    check(refined, orders_0, nodes_0);
+
+    // give the children of cell 1 distinct orders, then merge them back
+    std::vector<std::size_t> children;
+    for (std::size_t i = 0; i < refined.origin.size(); ++i) {
+      if (refined.origin[i] == mesh::CellOrigin::Refined) children.push_back(i);
+    }
+    ASSERT_EQ(children.size(), 4);
+    space.set_orders(children, std::vector<unsigned>{1, 4, 2, 1});
+    auto [orders_1, nodes_1] = snapshot();
+    auto coarsened = adaptive.coarsen(children);
+    space.update(coarsened);
+    check(coarsened, orders_1, nodes_1);
+    EXPECT_EQ(space.elements().size(), n_cells);
+    std::size_t n_merged = 0;
+    for (std::size_t i = 0; i < coarsened.origin.size(); ++i) {
+      if (coarsened.origin[i] != mesh::CellOrigin::Coarsened) continue;
+      EXPECT_EQ(space.orders()[i], 4);
+      n_merged++;
+    }
+    EXPECT_EQ(n_merged, 1);
+  }
+}
+
+TEST(test_dg_space, update_rejects_mismatched_change) {
+  mesh::AdaptiveMesh adaptive(test::grid_mesh(mesh::CellKind::Triangle, 2));
+  const std::size_t n_cells = adaptive.mesh().topology().n_cells();
+  dg::DGSpace space(adaptive.mesh(), std::vector<unsigned>(n_cells, 2));
+  mesh::AdaptChange change;
+  change.origin.assign(3, mesh::CellOrigin::Kept);
+  change.sources.assign(3, std::vector<std::size_t>{0});
+  EXPECT_THROW(space.update(change), std::invalid_argument);
+}
+
+TEST(test_dg_space, rejects_cells_with_extra_nodes) {
+  // a second-order triangle listing its edge midpoints after the vertices
+  std::vector<double> x = {0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 0.5, 0.0, 0.5, 0.5, 0.0, 0.5};
+  std::vector<mesh::CellType> cell_types = {mesh::get_cell_type(mesh::CellKind::Triangle)};
+  mesh::Mesh m(mesh::Topology({{0, 1, 2, 3, 4, 5}}, std::move(cell_types)),
+               mesh::Geometry(std::move(x), 2));
+  EXPECT_THROW(dg::DGSpace(m, {2}), std::invalid_argument);
+}
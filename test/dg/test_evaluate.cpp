@@ -0,0 +1,72 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "oiseau/dg/dg_space.hpp"
+#include "oiseau/dg/evaluate.hpp"
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/locate.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/test_meshes.hpp"
+
+using namespace oiseau;
+
+namespace {
+
+double cubic(double x, double y) { return x * x * y + 2.0 * y * y * y - x + 0.5; }
+
+}  // namespace
+
+TEST(test_evaluate, reproduces_polynomials) {
+  for (auto kind : {mesh::CellKind::Triangle, mesh::CellKind::Quadrilateral}) {
+    auto m = test::grid_mesh(kind, 4);
+    std::vector<unsigned> orders(m.topology().n_cells(), 3);
+    for (std::size_t i = 0; i < orders.size(); i += 3) orders[i] = 4;
+    dg::DGSpace space(m, orders);
+
+    std::vector<double> u(space.n_dofs());
+    for (std::size_t i = 0; i < space.elements().size(); i++) {
+      const auto& x = space.elements()[i].nodes();
+      for (std::size_t j = 0; j < x.shape()[0]; j++) {
+        u[space.offsets()[i] + j] = cubic(x(j, 0), x(j, 1));
+      }
+    }
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> coord(0.0, 1.0);
+    std::vector<double> points;
+    for (int p = 0; p < 200; p++) points.insert(points.end(), {coord(rng), coord(rng), 0.0});
+    points.insert(points.end(), {2.0, 0.5, 0.0});
+
+    mesh::PointLocator locator(m);
+    auto locations = locator.locate(points);
+    dg::PointEvaluator evaluator(space, locations);
+    ASSERT_EQ(evaluator.n_points(), 201);
+
+    // the plan is reused across fields
+    for (double scale : {1.0, -2.0}) {
+      std::vector<double> v(u);
+      for (auto& value : v) value *= scale;
+      auto values = evaluator.evaluate(v);
+      for (std::size_t p = 0; p < 200; p++) {
+        EXPECT_NEAR(values[p], scale * cubic(points[3 * p], points[3 * p + 1]), 1e-10)
+            << "point " << p << " on " << (kind == mesh::CellKind::Triangle ? "tri" : "quad");
+      }
+      EXPECT_TRUE(std::isnan(values[200]));
+    }
+    EXPECT_THROW(evaluator.evaluate(std::vector<double>(3)), std::invalid_argument);
+  }
+}
@@ -0,0 +1,139 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <vector>
+#include <xtensor/containers/xarray.hpp>
+
+#include "oiseau/dg/local_time_stepping.hpp"
+#include "oiseau/dg/nodal/element.hpp"
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/dg/time_integration.hpp"
+
+using namespace oiseau::dg;
+
+namespace {
+
+// periodic 1D upwind finite volumes for u_t + u_x = 0, coarse on the left, fine on the right
+struct Advection {
+  std::vector<double> dx;
+
+  Advection() {
+    dx.insert(dx.end(), 8, 1.0 / 16);
+    dx.insert(dx.end(), 16, 1.0 / 64);
+    dx.insert(dx.end(), 32, 1.0 / 128);
+  }
+
+  std::size_t n() const { return dx.size(); }
+
+  void operator()(double, std::span<const double> u, std::span<double> dudt,
+                  std::span<const std::size_t> cells, const FaceSelection& faces) const {
+    for (auto i : cells) {
+      const std::size_t left = (i + n() - 1) % n();
+      const std::size_t right = (i + 1) % n();
+      dudt[i] = 0.0;
+      if (faces.includes(left)) dudt[i] += u[left] / dx[i];
+      if (faces.includes(right)) dudt[i] -= u[i] / dx[i];
+    }
+  }
+
+  std::vector<double> initial() const {
+    std::vector<double> u;
+    double x = 0.0;
+    for (auto h : dx) {
+      u.push_back(2.0 + std::sin(2.0 * std::numbers::pi * (x + 0.5 * h)));
+      x += h;
+    }
+    return u;
+  }
+
+  double mass(const std::vector<double>& u) const {
+    double m = 0.0;
+    for (std::size_t i = 0; i < n(); i++) m += dx[i] * u[i];
+    return m;
+  }
+};
+
+}  // namespace
+
+TEST(test_local_time_stepping, assign_levels) {
+  std::vector<double> dt = {1.0, 0.1, 0.3, 0.9, 0.12, 0.5};
+  auto levels = assign_time_levels(dt, 8);
+  EXPECT_EQ(levels.n_levels(), 4);
+  EXPECT_DOUBLE_EQ(levels.dt, 0.8);
+  EXPECT_EQ(levels.level, std::vector<unsigned>({0, 3, 2, 0, 3, 1}));
+  EXPECT_EQ(levels.new_to_old, std::vector<std::size_t>({0, 3, 5, 2, 1, 4}));
+  EXPECT_EQ(levels.level_offsets, std::vector<std::size_t>({0, 2, 3, 4, 6}));
+  for (std::size_t i = 0; i < dt.size(); i++) {
+    EXPECT_LE(levels.dt / (1u << levels.level[i]), dt[i]);
+  }
+
+  auto capped = assign_time_levels(dt, 2);
+  EXPECT_EQ(capped.n_levels(), 2);
+  EXPECT_DOUBLE_EQ(capped.dt, 0.2);
+  EXPECT_EQ(capped.level, std::vector<unsigned>({0, 1, 0, 0, 1, 0}));
+}
+
+TEST(test_local_time_stepping, stable_time_step_from_nodes) {
+  auto ref = oiseau::dg::nodal::get_ref_element(oiseau::dg::nodal::RefElementType::Triangle, 1);
+  xt::xarray<double> nodes = {{0.0, 0.0}, {2.0, 0.0}, {0.0, 0.5}};
+  oiseau::dg::nodal::Element element(ref, nodes);
+  EXPECT_DOUBLE_EQ(stable_time_step(element, 0.4, 2.0), 0.1);
+}
+
+TEST(test_local_time_stepping, conservative_and_consistent) {
+  Advection advection;
+  std::vector<double> stable_dt;
+  for (auto h : advection.dx) stable_dt.push_back(0.5 * h);
+  auto levels = assign_time_levels(stable_dt, 8);
+  ASSERT_TRUE(std::ranges::is_sorted(levels.level));
+  EXPECT_EQ(levels.n_levels(), 4);
+
+  std::vector<std::vector<std::size_t>> e_to_e;
+  std::vector<std::size_t> offsets;
+  for (std::size_t i = 0; i < advection.n(); i++) {
+    e_to_e.push_back({(i + advection.n() - 1) % advection.n(), (i + 1) % advection.n()});
+    offsets.push_back(i);
+  }
+  offsets.push_back(advection.n());
+
+  for (auto scheme : {RKScheme::SSPRK3, RKScheme::LSERK4}) {
+    LocalTimeStepper lts(scheme, levels.level, levels.dt, e_to_e, offsets);
+    std::vector<double> u = advection.initial();
+    const double mass = advection.mass(u);
+    const std::size_t n_steps = static_cast<std::size_t>(std::round(0.5 / levels.dt));
+    for (std::size_t s = 0; s < n_steps; s++) lts.step(advection, s * levels.dt, u);
+    EXPECT_NEAR(advection.mass(u), mass, 1e-13);
+
+    // reference: every cell at the finest step
+    std::vector<unsigned> all_fine(advection.n(), 0);
+    const FaceSelection all = {true, all_fine, 0, 0};
+    std::vector<std::size_t> cells(advection.n());
+    for (std::size_t i = 0; i < cells.size(); i++) cells[i] = i;
+    LowStorageRK rk(scheme, advection.n());
+    std::vector<double> v = advection.initial();
+    auto rhs = [&](double t, std::span<const double> w, std::span<double> dwdt) {
+      advection(t, w, dwdt, cells, all);
+    };
+    rk.integrate(rhs, 0.0, n_steps * levels.dt, levels.dt / 8, v);
+    for (std::size_t i = 0; i < advection.n(); i++) EXPECT_NEAR(u[i], v[i], 2e-2);
+  }
+}
+
+TEST(test_local_time_stepping, requires_cells_grouped_by_level) {
+  std::vector<unsigned> levels = {1, 0};
+  std::vector<std::vector<std::size_t>> e_to_e = {{1}, {0}};
+  std::vector<std::size_t> offsets = {0, 1, 2};
+  EXPECT_THROW(LocalTimeStepper(RKScheme::SSPRK3, levels, 1.0, e_to_e, offsets),
+               std::invalid_argument);
+}
@@ -0,0 +1,75 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include <xtensor-blas/xlinalg.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+#include <xtensor/misc/xmanipulation.hpp>
+
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/dg/nonconforming.hpp"
+#include "oiseau/test_macros.hpp"
+
+using namespace oiseau::dg;
+
+TEST(test_nonconforming, interpolation_is_exact_for_coarse_polynomials) {
+  for (unsigned coarse = 1; coarse <= 4; ++coarse) {
+    const auto& rc = nodal::get_ref_element(nodal::RefElementType::Line, coarse)->r();
+    for (unsigned fine = coarse; fine <= coarse + 2; ++fine) {
+      const auto& rf = nodal::get_ref_element(nodal::RefElementType::Line, fine)->r();
+      for (int half : {0, 1}) {
+        for (bool reversed : {false, true}) {
+          auto interp = face_interpolation_matrix(coarse, fine, half, reversed);
+          ASSERT_EQ(interp.shape()[0], fine + 1);
+          ASSERT_EQ(interp.shape()[1], coarse + 1);
+          for (unsigned degree = 0; degree <= coarse; ++degree) {
+            for (std::size_t p = 0; p <= fine; ++p) {
+              // fine node p in the coordinate of the coarse face
+              const double s = 0.5 * ((reversed ? -rf(p) : rf(p)) + (half == 0 ? -1.0 : 1.0));
+              double value = 0.0;
+              for (std::size_t q = 0; q <= coarse; ++q) {
+                value += interp(p, q) * std::pow(rc(q), degree);
+              }
+              EXPECT_NEAR(value, std::pow(s, degree), 1e-12)
+                  << "orders " << coarse << " -> " << fine << ", half " << half;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(test_nonconforming, half_projections_recombine_to_coarse_trace) {
+  for (unsigned coarse = 1; coarse <= 4; ++coarse) {
+    for (unsigned fine = coarse; fine <= coarse + 2; ++fine) {
+      for (bool reversed_0 : {false, true}) {
+        for (bool reversed_1 : {false, true}) {
+          const std::vector<std::size_t> shape = {coarse + 1, coarse + 1};
+          xt::xarray<double> sum = xt::zeros<double>(shape);
+          for (int half : {0, 1}) {
+            const bool reversed = half == 0 ? reversed_0 : reversed_1;
+            sum += xt::linalg::dot(face_projection_matrix(coarse, fine, half, reversed),
+                                   face_interpolation_matrix(coarse, fine, half, reversed));
+          }
+          auto flat = xt::flatten(sum);
+          auto expected = xt::flatten(xt::eye<double>(coarse + 1));
+          EXPECT_FLOATS_NEARLY_EQ(flat, expected, 1e-11);
+        }
+      }
+    }
+  }
+}
+
+TEST(test_nonconforming, rejects_invalid_half) {
+  EXPECT_THROW(face_interpolation_matrix(2, 2, 2, false), std::invalid_argument);
+  EXPECT_THROW(face_projection_matrix(2, 2, -1, false), std::invalid_argument);
+}
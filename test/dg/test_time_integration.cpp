@@ -0,0 +1,69 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "oiseau/dg/time_integration.hpp"
+
+using namespace oiseau::dg;
+
+namespace {
+
+// u' = -u + cos(t) for the first entry, u' = -2 u for the second: exercises the stage times
+void rhs(double t, std::span<const double> u, std::span<double> dudt) {
+  dudt[0] = -u[0] + std::cos(t);
+  dudt[1] = -2.0 * u[1];
+}
+
+std::vector<double> exact(double t) {
+  return {0.5 * (std::cos(t) + std::sin(t)) + 0.5 * std::exp(-t), std::exp(-2.0 * t)};
+}
+
+double error(RKScheme scheme, std::size_t n_steps) {
+  LowStorageRK rk(scheme, 2);
+  std::vector<double> u = {1.0, 1.0};
+  const double t1 = 2.0;
+  EXPECT_EQ(rk.integrate(rhs, 0.0, t1, t1 / n_steps, u), n_steps);
+  auto ref = exact(t1);
+  return std::max(std::abs(u[0] - ref[0]), std::abs(u[1] - ref[1]));
+}
+
+}  // namespace
+
+TEST(test_time_integration, lserk4_is_fourth_order) {
+  double ratio = error(RKScheme::LSERK4, 20) / error(RKScheme::LSERK4, 40);
+  EXPECT_NEAR(std::log2(ratio), 4.0, 0.2);
+}
+
+TEST(test_time_integration, ssprk3_is_third_order) {
+  double ratio = error(RKScheme::SSPRK3, 20) / error(RKScheme::SSPRK3, 40);
+  EXPECT_NEAR(std::log2(ratio), 3.0, 0.2);
+}
+
+TEST(test_time_integration, integrate_shortens_last_step) {
+  LowStorageRK rk(RKScheme::SSPRK3, 1);
+  std::vector<double> u = {0.0};
+  double t_last = 0.0;
+  auto f = [&](double t, std::span<const double>, std::span<double> dudt) {
+    t_last = std::max(t_last, t);
+    dudt[0] = 1.0;
+  };
+  EXPECT_EQ(rk.integrate(f, 0.0, 1.0, 0.3, u), 4);
+  EXPECT_NEAR(u[0], 1.0, 1e-14);
+  EXPECT_NEAR(t_last, 1.0, 1e-14);
+  EXPECT_EQ(rk.n_stages(), 3);
+}
+
+TEST(test_time_integration, rejects_mismatched_fields) {
+  LowStorageRK rk(RKScheme::LSERK4, 3);
+  std::vector<double> u(2);
+  EXPECT_THROW(rk.step(rhs, 0.0, 0.1, u), std::invalid_argument);
+}
@@ -7,13 +7,16 @@
 #include <gtest/gtest.h>
 
 #include <cstddef>
+#include <map>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "oiseau/io/gmsh.hpp"
 #include "oiseau/mesh/cell.hpp"
 #include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
 
 TEST(test_io, gmsh_read_from_string_3d_tetra_block) {
   std::string str =
@@ -112,6 +115,148 @@ $EndElements)";
   EXPECT_EQ(actual, expected);
 }
 
+TEST(test_io, gmsh_read_from_string_2d_physical_tags) {
+  std::string str =
+      R"($MeshFormat
+4.1 0 8
+$EndMeshFormat
+$PhysicalNames
+2
+1 11 "bottom"
+2 21 "domain"
+$EndPhysicalNames
+$Entities
+0 2 1 0
+1 0 0 0 1 0 0 1 11 0
+2 0 0 0 1 1 0 0 0
+1 0 0 0 1 1 0 1 21 0
+$EndEntities
+$Nodes
+1 4 1 4
+2 1 0 4
+1
+2
+3
+4
+0 0 0
+1 0 0
+1 1 0
+0 1 0
+$EndNodes
+$Elements
+3 6 1 6
+1 1 1 1
+1 1 2
+1 2 1 3
+2 2 3
+3 3 4
+4 4 1
+2 1 2 2
+5 1 2 3
+6 1 3 4
+$EndElements)";
+  oiseau::mesh::Mesh mesh = oiseau::io::gmsh_read_from_string(str);
+  auto& topology = mesh.topology();
+
+  auto conn = topology.conn();
+  std::vector<std::vector<size_t>> actual(conn.begin(), conn.end());
+  std::vector<std::vector<size_t>> expected = {{0, 1, 2}, {0, 2, 3}};
+  EXPECT_EQ(actual, expected);
+
+  auto cell_tags = topology.cell_tags();
+  EXPECT_EQ(std::vector<int>(cell_tags.begin(), cell_tags.end()), std::vector<int>({21, 21}));
+
+  auto facets = topology.boundary_facets();
+  auto facet_tags = topology.boundary_facet_tags();
+  EXPECT_EQ(facets.size(), 4);
+  EXPECT_EQ(std::vector<int>(facet_tags.begin(), facet_tags.end()),
+            std::vector<int>({11, oiseau::mesh::UNTAGGED, oiseau::mesh::UNTAGGED,
+                              oiseau::mesh::UNTAGGED}));
+
+  std::map<std::pair<int, int>, std::string> names = {{{1, 11}, "bottom"}, {{2, 21}, "domain"}};
+  EXPECT_EQ(topology.physical_names(), names);
+
+  topology.calculate_connectivity();
+  auto tags = topology.facet_tags();
+  EXPECT_EQ(tags[0], std::vector<int>({oiseau::mesh::UNTAGGED, oiseau::mesh::UNTAGGED, 11}));
+  EXPECT_EQ(tags[1], std::vector<int>(3, oiseau::mesh::UNTAGGED));
+}
+
+TEST(test_io, gmsh_read_from_string_sparse_node_tags) {
+  std::string str = R"($MeshFormat
+4.1 0 8
+$EndMeshFormat
+$Nodes
+2 4 10 5000
+2 1 0 2
+5000
+10
+1 1 0
+0 0 0
+2 2 0 2
+700
+20
+0 1 0
+1 0 0
+$EndNodes
+$Elements
+1 2 1 2
+2 1 2 2
+1 10 20 5000
+2 10 5000 700
+$EndElements)";
+  oiseau::mesh::Mesh mesh = oiseau::io::gmsh_read_from_string(str);
+  auto conn = mesh.topology().conn();
+  std::vector<std::vector<size_t>> actual(conn.begin(), conn.end());
+  std::vector<std::vector<size_t>> expected = {{1, 3, 0}, {1, 0, 2}};
+  EXPECT_EQ(actual, expected);
+}
+
+TEST(test_io, gmsh_read_from_string_undefined_node_tag) {
+  std::string str = R"($MeshFormat
+4.1 0 8
+$EndMeshFormat
+$Nodes
+1 3 1 3
+2 1 0 3
+1
+2
+3
+0 0 0
+1 0 0
+0 1 0
+$EndNodes
+$Elements
+1 1 1 1
+2 1 2 1
+1 1 2 4
+$EndElements)";
+  EXPECT_THROW(oiseau::io::gmsh_read_from_string(str), std::runtime_error);
+}
+
+TEST(test_io, node_tag_map) {
+  using oiseau::io::detail::NodeTagMap;
+  std::vector<oiseau::io::NodesBlock> dense_blocks;
+  dense_blocks.emplace_back(2, 1, 0, 3, std::vector<std::size_t>{3, 4, 2},
+                            std::vector<double>(9, 0.0));
+  NodeTagMap dense(oiseau::io::NodesSection(1, 3, 2, 4, std::move(dense_blocks)));
+  EXPECT_TRUE(dense.is_dense());
+  EXPECT_EQ(dense(3), 0);
+  EXPECT_EQ(dense(4), 1);
+  EXPECT_EQ(dense(2), 2);
+  EXPECT_EQ(dense(1), NodeTagMap::INVALID);
+  EXPECT_EQ(dense(5), NodeTagMap::INVALID);
+
+  std::vector<oiseau::io::NodesBlock> sparse_blocks;
+  sparse_blocks.emplace_back(2, 1, 0, 2, std::vector<std::size_t>{1000000, 7},
+                             std::vector<double>(6, 0.0));
+  NodeTagMap sparse(oiseau::io::NodesSection(1, 2, 7, 1000000, std::move(sparse_blocks)));
+  EXPECT_FALSE(sparse.is_dense());
+  EXPECT_EQ(sparse(1000000), 0);
+  EXPECT_EQ(sparse(7), 1);
+  EXPECT_EQ(sparse(8), NodeTagMap::INVALID);
+}
+
 TEST(test_io, gmsh_celltype_to_oiseau_celltype) {
   EXPECT_EQ(oiseau::io::detail::gmsh_celltype_to_oiseau_celltype(15),
             oiseau::mesh::get_cell_type(oiseau::mesh::CellKind::Point));
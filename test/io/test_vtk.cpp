@@ -0,0 +1,124 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "oiseau/dg/dg_space.hpp"
+#include "oiseau/dg/nodal/ref_element.hpp"
+#include "oiseau/io/vtk.hpp"
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/test_meshes.hpp"
+
+using namespace oiseau;
+
+namespace {
+
+std::string read_file(const std::filesystem::path& path) {
+  std::ifstream in(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+// the appended arrays following the '_' marker, as (byte count, first byte) pairs
+std::vector<std::pair<std::uint64_t, const char*>> appended_arrays(const std::string& file,
+                                                                  std::size_t n_arrays) {
+  std::vector<std::pair<std::uint64_t, const char*>> arrays;
+  const char* p = file.data() + file.find("<AppendedData encoding=\"raw\">\n_") + 31;
+  for (std::size_t k = 0; k < n_arrays; k++) {
+    std::uint64_t n_bytes;
+    std::memcpy(&n_bytes, p, sizeof(n_bytes));
+    arrays.push_back({n_bytes, p + sizeof(n_bytes)});
+    p += sizeof(n_bytes) + n_bytes;
+  }
+  return arrays;
+}
+
+}  // namespace
+
+TEST(test_vtk, lagrange_points) {
+  auto tri = io::detail::vtk_lagrange_points(dg::nodal::RefElementType::Triangle, 3);
+  ASSERT_EQ(tri.shape()[0], 10);
+  EXPECT_DOUBLE_EQ(tri(1, 0), 1.0);
+  EXPECT_DOUBLE_EQ(tri(2, 1), 1.0);
+  EXPECT_DOUBLE_EQ(tri(3, 0), -1.0 / 3.0);
+  EXPECT_DOUBLE_EQ(tri(9, 0), -1.0 / 3.0);
+  EXPECT_DOUBLE_EQ(tri(9, 1), -1.0 / 3.0);
+
+  auto quad = io::detail::vtk_lagrange_points(dg::nodal::RefElementType::Quadrilateral, 2);
+  ASSERT_EQ(quad.shape()[0], 9);
+  EXPECT_DOUBLE_EQ(quad(2, 0), 1.0);
+  EXPECT_DOUBLE_EQ(quad(2, 1), 1.0);
+  EXPECT_DOUBLE_EQ(quad(6, 0), 0.0);
+  EXPECT_DOUBLE_EQ(quad(6, 1), 1.0);
+  EXPECT_DOUBLE_EQ(quad(8, 0), 0.0);
+  EXPECT_DOUBLE_EQ(quad(8, 1), 0.0);
+}
+
+TEST(test_vtk, vtu_write_appended_data) {
+  auto m = test::grid_mesh(mesh::CellKind::Triangle, 1);
+  dg::DGSpace space(m, {3, 3});
+  std::vector<double> u(space.n_dofs());
+  for (std::size_t i = 0; i < space.elements().size(); i++) {
+    const auto& x = space.elements()[i].nodes();
+    for (std::size_t j = 0; j < x.shape()[0]; j++) u[space.offsets()[i] + j] = 2.0 * x(j, 0);
+  }
+  const std::vector<io::VTKField> fields = {{"u", u, 1}};
+  const auto path = std::filesystem::temp_directory_path() / "oiseau_test_vtk.vtu";
+  io::vtu_write(path, space, fields);
+
+  const std::string file = read_file(path);
+  const std::size_t n_points = space.n_dofs();
+  EXPECT_NE(file.find("NumberOfPoints=\"" + std::to_string(n_points) + "\""), std::string::npos);
+  EXPECT_NE(file.find("NumberOfCells=\"2\""), std::string::npos);
+  EXPECT_NE(file.find("Name=\"u\""), std::string::npos);
+  EXPECT_TRUE(file.ends_with("</AppendedData>\n</VTKFile>\n"));
+
+  // u, points, connectivity, offsets, types
+  auto arrays = appended_arrays(file, 5);
+  ASSERT_EQ(arrays[0].first, n_points * sizeof(double));
+  ASSERT_EQ(arrays[1].first, 3 * n_points * sizeof(double));
+  EXPECT_EQ(arrays[4].first, 2);
+  EXPECT_EQ(static_cast<std::uint8_t>(arrays[4].second[0]), 69);
+  for (std::size_t k = 0; k < n_points; k++) {
+    double value, x;
+    std::memcpy(&value, arrays[0].second + k * sizeof(double), sizeof(double));
+    std::memcpy(&x, arrays[1].second + 3 * k * sizeof(double), sizeof(double));
+    EXPECT_NEAR(value, 2.0 * x, 1e-12);
+  }
+  std::filesystem::remove(path);
+
+  // ghost cells past n_cells are left out
+  io::vtu_write(path, space, fields, 1);
+  EXPECT_NE(read_file(path).find("NumberOfCells=\"1\""), std::string::npos);
+  std::filesystem::remove(path);
+  EXPECT_THROW(io::vtu_write(path, space, std::vector<io::VTKField>{{"v", u, 2}}),
+               std::invalid_argument);
+}
+
+TEST(test_vtk, pvtu_write) {
+  const auto path = std::filesystem::temp_directory_path() / "oiseau_test_vtk.pvtu";
+  EXPECT_EQ(io::vtu_piece_path(path, 3).filename(), "oiseau_test_vtk_3.vtu");
+  const std::vector<double> u;
+  io::pvtu_write(path, 2, std::vector<io::VTKField>{{"u", u, 3}});
+  const std::string file = read_file(path);
+  EXPECT_NE(file.find("<Piece Source=\"oiseau_test_vtk_0.vtu\"/>"), std::string::npos);
+  EXPECT_NE(file.find("<Piece Source=\"oiseau_test_vtk_1.vtu\"/>"), std::string::npos);
+  EXPECT_NE(file.find("Name=\"u\" NumberOfComponents=\"3\""), std::string::npos);
+  std::filesystem::remove(path);
+}
@@ -0,0 +1,230 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "oiseau/mesh/adapt.hpp"
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/test_meshes.hpp"
+
+using namespace oiseau::mesh;
+
+namespace {
+
+// n x n grid on the unit square, bottom edge tagged 1 and top edge tagged 2
+Mesh grid_mesh(std::size_t n, CellKind kind) {
+  return oiseau::test::grid_mesh(kind, n, 3, {.bottom = 1, .top = 2});
+}
+
+std::vector<std::size_t> all_cells(const AdaptiveMesh& adaptive) {
+  std::vector<std::size_t> cells(adaptive.mesh().topology().n_cells());
+  std::iota(cells.begin(), cells.end(), 0);
+  return cells;
+}
+
+// checks every face against the non-conforming records and the 2:1 balance
+void expect_consistent(const AdaptiveMesh& adaptive) {
+  const auto& topology = adaptive.mesh().topology();
+  auto conn = topology.conn();
+  auto e_to_e = topology.e_to_e();
+  auto e_to_f = topology.e_to_f();
+  auto levels = adaptive.levels();
+  auto faces = adaptive.nonconforming_faces();
+  auto face_vertices = [&](std::size_t c, std::size_t f) {
+    auto edges = topology.cell_types()[c]->get_entity_vertices(1);
+    return std::pair{conn[c][edges[f][0]], conn[c][edges[f][1]]};
+  };
+
+  for (std::size_t i = 0; i < topology.n_cells(); i++) {
+    for (std::size_t f = 0; f < e_to_e[i].size(); f++) {
+      std::size_t k = e_to_e[i][f];
+      std::size_t g = e_to_f[i][f];
+      if (k == i) continue;
+      EXPECT_LE(std::max(levels[i], levels[k]) - std::min(levels[i], levels[k]), 1u);
+      if (levels[k] == levels[i]) {
+        EXPECT_EQ(e_to_e[k][g], i);
+        EXPECT_EQ(e_to_f[k][g], f);
+        auto [a, b] = face_vertices(i, f);
+        auto [c, d] = face_vertices(k, g);
+        EXPECT_TRUE((a == c && b == d) || (a == d && b == c));
+        continue;
+      }
+      auto coarse = levels[k] < levels[i] ? std::pair{k, g} : std::pair{i, f};
+      auto it = std::ranges::find_if(faces, [&](const NonConformingFace& face) {
+        return face.coarse_cell == coarse.first && face.coarse_face == coarse.second;
+      });
+      ASSERT_NE(it, faces.end());
+    }
+  }
+
+  for (const auto& face : faces) {
+    EXPECT_EQ(e_to_e[face.coarse_cell][face.coarse_face], face.fine_cells[0]);
+    auto [a, b] = face_vertices(face.coarse_cell, face.coarse_face);
+    for (int h = 0; h < 2; h++) {
+      EXPECT_EQ(e_to_e[face.fine_cells[h]][face.fine_faces[h]], face.coarse_cell);
+      EXPECT_EQ(e_to_f[face.fine_cells[h]][face.fine_faces[h]], face.coarse_face);
+      auto [p, q] = face_vertices(face.fine_cells[h], face.fine_faces[h]);
+      if (face.reversed[h]) std::swap(p, q);
+      EXPECT_EQ(h == 0 ? p : q, h == 0 ? a : b);
+    }
+    auto [m0, m1] = face_vertices(face.fine_cells[0], face.fine_faces[0]);
+    auto [n0, n1] = face_vertices(face.fine_cells[1], face.fine_faces[1]);
+    EXPECT_EQ(face.reversed[0] ? m0 : m1, face.reversed[1] ? n1 : n0);
+  }
+}
+
+std::size_t count_tagged(const Topology& topology) {
+  std::size_t tagged = 0;
+  for (const auto& tags : topology.facet_tags()) {
+    for (auto tag : tags) tagged += (tag != UNTAGGED);
+  }
+  return tagged;
+}
+
+}  // namespace
+
+TEST(test_adapt, uniform_matches_full_connectivity) {
+  for (auto kind : {CellKind::Triangle, CellKind::Quadrilateral}) {
+    AdaptiveMesh adaptive(grid_mesh(3, kind));
+    for (int pass = 0; pass < 2; pass++) {
+      auto change = adaptive.refine(all_cells(adaptive));
+      EXPECT_TRUE(std::ranges::all_of(change.origin,
+                                      [](CellOrigin o) { return o == CellOrigin::Refined; }));
+    }
+    EXPECT_TRUE(adaptive.nonconforming_faces().empty());
+
+    Topology full = adaptive.mesh().topology();
+    full.calculate_connectivity();
+    const auto& topology = adaptive.mesh().topology();
+    for (std::size_t i = 0; i < topology.n_cells(); i++) {
+      EXPECT_EQ(topology.e_to_e()[i], full.e_to_e()[i]);
+      EXPECT_EQ(topology.e_to_f()[i], full.e_to_f()[i]);
+      EXPECT_EQ(topology.facet_tags()[i], full.facet_tags()[i]);
+    }
+    EXPECT_EQ(count_tagged(topology), 2 * 3 * 4);
+  }
+}
+
+TEST(test_adapt, single_refinement_creates_hanging_faces) {
+  AdaptiveMesh adaptive(grid_mesh(2, CellKind::Quadrilateral));
+  std::vector<std::size_t> marked = {0};
+  auto change = adaptive.refine(marked);
+
+  EXPECT_EQ(adaptive.mesh().topology().n_cells(), 7);
+  EXPECT_EQ(adaptive.mesh().geometry().n_nodes(), 9 + 5);
+  EXPECT_EQ(adaptive.nonconforming_faces().size(), 2);
+  for (int k = 0; k < 4; k++) {
+    EXPECT_EQ(change.origin[k], CellOrigin::Refined);
+    EXPECT_EQ(change.sources[k], std::vector<std::size_t>({0}));
+    EXPECT_EQ(change.child_index[k], k);
+  }
+  for (std::size_t i = 4; i < 7; i++) {
+    EXPECT_EQ(change.origin[i], CellOrigin::Kept);
+    EXPECT_EQ(change.sources[i], std::vector<std::size_t>({i - 3}));
+  }
+  expect_consistent(adaptive);
+}
+
+TEST(test_adapt, refinement_keeps_two_to_one_balance) {
+  for (auto kind : {CellKind::Triangle, CellKind::Quadrilateral}) {
+    AdaptiveMesh adaptive(grid_mesh(4, kind));
+    // keep refining the cell that touches the centre of the square
+    for (int pass = 0; pass < 4; pass++) {
+      const auto& mesh = adaptive.mesh();
+      std::vector<std::size_t> marked;
+      for (std::size_t i = 0; i < mesh.topology().n_cells(); i++) {
+        for (auto v : mesh.topology().conn()[i]) {
+          auto x = mesh.geometry().x_at(v);
+          if (x[0] == 0.5 && x[1] == 0.5) marked.push_back(i);
+        }
+      }
+      adaptive.refine(marked);
+      expect_consistent(adaptive);
+    }
+    auto levels = adaptive.levels();
+    EXPECT_EQ(*std::ranges::max_element(levels), 4u);
+    EXPECT_FALSE(adaptive.nonconforming_faces().empty());
+
+    // groups next to finer cells must stay refined
+    adaptive.coarsen(all_cells(adaptive));
+    expect_consistent(adaptive);
+    EXPECT_EQ(*std::ranges::max_element(adaptive.levels()), 3u);
+  }
+}
+
+TEST(test_adapt, coarsening_restores_the_original_mesh) {
+  for (auto kind : {CellKind::Triangle, CellKind::Quadrilateral}) {
+    Mesh original = grid_mesh(3, kind);
+    original.topology().calculate_connectivity();
+    AdaptiveMesh adaptive{Mesh(original)};
+
+    std::vector<std::size_t> marked = {4};
+    adaptive.refine(marked);
+    adaptive.refine(std::vector<std::size_t>{4, 5});
+    expect_consistent(adaptive);
+
+    // incomplete sibling groups are left alone
+    std::vector<std::size_t> some = {5, 6, 7};
+    auto change = adaptive.coarsen(some);
+    EXPECT_TRUE(std::ranges::all_of(change.origin,
+                                    [](CellOrigin o) { return o == CellOrigin::Kept; }));
+
+    for (int pass = 0; pass < 2; pass++) {
+      auto levels = adaptive.levels();
+      std::vector<std::size_t> finest;
+      auto top = *std::ranges::max_element(levels);
+      for (std::size_t i = 0; i < levels.size(); i++) {
+        if (levels[i] == top) finest.push_back(i);
+      }
+      change = adaptive.coarsen(finest);
+      EXPECT_TRUE(std::ranges::any_of(change.origin,
+                                      [](CellOrigin o) { return o == CellOrigin::Coarsened; }));
+      expect_consistent(adaptive);
+    }
+
+    const auto& topology = adaptive.mesh().topology();
+    ASSERT_EQ(topology.n_cells(), original.topology().n_cells());
+    EXPECT_TRUE(adaptive.nonconforming_faces().empty());
+    for (std::size_t i = 0; i < topology.n_cells(); i++) {
+      EXPECT_EQ(topology.conn()[i], original.topology().conn()[i]);
+      EXPECT_EQ(topology.e_to_e()[i], original.topology().e_to_e()[i]);
+      EXPECT_EQ(topology.e_to_f()[i], original.topology().e_to_f()[i]);
+      EXPECT_EQ(topology.facet_tags()[i], original.topology().facet_tags()[i]);
+    }
+  }
+}
+
+TEST(test_adapt, facet_tags_follow_refinement) {
+  AdaptiveMesh adaptive(grid_mesh(2, CellKind::Quadrilateral));
+  std::vector<std::size_t> marked = {0, 3};
+  adaptive.refine(marked);
+  const auto& topology = adaptive.mesh().topology();
+  EXPECT_EQ(count_tagged(topology), 6);
+  EXPECT_EQ(topology.boundary_facets().size(), 6);
+  for (std::size_t i = 0; i < topology.n_cells(); i++) {
+    for (std::size_t f = 0; f < topology.e_to_e()[i].size(); f++) {
+      if (topology.facet_tags()[i][f] != UNTAGGED) {
+        EXPECT_EQ(topology.e_to_e()[i][f], i);
+      }
+    }
+  }
+}
+
+TEST(test_adapt, rejects_unsupported_cells) {
+  std::vector<CellType> cell_types = {get_cell_type(CellKind::Tetrahedron)};
+  Mesh mesh(Topology({{0, 1, 2, 3}}, std::move(cell_types)),
+            Geometry({0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1}, 3));
+  EXPECT_THROW(AdaptiveMesh{std::move(mesh)}, std::invalid_argument);
+}
@@ -6,6 +6,10 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <thread>
+#include <vector>
+
 #include "oiseau/mesh/cell.hpp"
 
 TEST(test_mesh, triangle_cell) {
@@ -17,3 +21,16 @@ TEST(test_mesh, triangle_cell) {
   EXPECT_EQ(tricell.dimension(), 2);
   auto cell = TriangleCell();
 }
+
+TEST(test_mesh, get_cell_type_from_threads) {
+  using namespace oiseau::mesh;
+  std::vector<CellType> found(8, nullptr);
+  {
+    std::vector<std::jthread> threads;
+    for (std::size_t t = 0; t < found.size(); ++t) {
+      threads.emplace_back([&found, t] { found[t] = get_cell_type(CellKind::Hexahedron); });
+    }
+  }
+  for (auto cell : found) EXPECT_EQ(cell, found.front());
+  EXPECT_STREQ(found.front()->name().data(), "hexahedron");
+}
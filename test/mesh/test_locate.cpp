@@ -0,0 +1,106 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/locate.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/test_meshes.hpp"
+
+using namespace oiseau::mesh;
+
+namespace {
+
+// n x n x n hexahedra on the unit cube, with the top face pushed up in the middle
+Mesh cube_mesh(std::size_t n) {
+  Mesh mesh = oiseau::test::grid_mesh(CellKind::Hexahedron, n);
+  auto x = mesh.geometry().x();
+  for (std::size_t p = 0; p < x.size(); p += 3) x[p + 2] *= 1.0 + 0.5 * x[p] * (1.0 - x[p]);
+  return mesh;
+}
+
+}  // namespace
+
+TEST(test_locate, quadrilaterals) {
+  const std::size_t n = 16;
+  Mesh mesh = oiseau::test::grid_mesh(CellKind::Quadrilateral, n, 2);
+  PointLocator locator(mesh);
+
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> coord(0.0, 1.0);
+  std::vector<double> points(2 * 1000);
+  for (auto& p : points) p = coord(rng);
+  auto locations = locator.locate(points);
+  ASSERT_EQ(locations.size(), 1000);
+  for (std::size_t p = 0; p < locations.size(); p++) {
+    const double x = points[2 * p], y = points[2 * p + 1];
+    ASSERT_NE(locations[p].cell, NOT_FOUND);
+    const std::size_t i = locations[p].cell % n, j = locations[p].cell / n;
+    EXPECT_NEAR(locations[p].ref[0], 2.0 * (x * n - i) - 1.0, 1e-10);
+    EXPECT_NEAR(locations[p].ref[1], 2.0 * (y * n - j) - 1.0, 1e-10);
+  }
+}
+
+TEST(test_locate, triangles_embedded_in_3d) {
+  const std::size_t n = 8;
+  Mesh mesh = oiseau::test::grid_mesh(CellKind::Triangle, n, 3);
+  PointLocator locator(mesh);
+
+  // lower-left triangle of the square (2, 5), at barycentric (0.2, 0.5, 0.3)
+  std::vector<double> x = {(2.0 + 0.5) / n, (5.0 + 0.3) / n, 0.0};
+  auto location = locator.locate_point(x);
+  EXPECT_EQ(location.cell, 2 * (5 * n + 2));
+  EXPECT_NEAR(location.ref[0], 0.0, 1e-12);
+  EXPECT_NEAR(location.ref[1], -0.4, 1e-12);
+
+  // vertices and edges belong to some cell
+  for (double v : {0.0, 0.5, 1.0}) {
+    EXPECT_NE(locator.locate_point(std::vector<double>{v, v, 0.0}).cell, NOT_FOUND);
+    EXPECT_NE(locator.locate_point(std::vector<double>{v, 0.3, 0.0}).cell, NOT_FOUND);
+  }
+  EXPECT_EQ(locator.locate_point(std::vector<double>{0.5, 0.5, 0.1}).cell, NOT_FOUND);
+  EXPECT_EQ(locator.locate_point(std::vector<double>{1.5, 0.5, 0.0}).cell, NOT_FOUND);
+  EXPECT_THROW(locator.locate_point(std::vector<double>{0.5, 0.5}), std::invalid_argument);
+}
+
+TEST(test_locate, curved_hexahedra) {
+  const std::size_t n = 4;
+  Mesh mesh = cube_mesh(n);
+  PointLocator locator(mesh);
+  const auto& geometry = mesh.geometry();
+
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<double> coord(-1.0, 1.0);
+  std::uniform_int_distribution<std::size_t> pick(0, n * n * n - 1);
+  for (int t = 0; t < 200; t++) {
+    // map a random reference point through a random cell and find it back
+    const std::size_t cell = pick(rng);
+    const double xi[3] = {coord(rng), coord(rng), coord(rng)};
+    const double s[8][3] = {{-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+                            {-1, -1, 1},  {1, -1, 1},  {1, 1, 1},  {-1, 1, 1}};
+    std::vector<double> x(3, 0.0);
+    for (std::size_t v = 0; v < 8; v++) {
+      double w = 1.0;
+      for (int d = 0; d < 3; d++) w *= 0.5 * (1.0 + s[v][d] * xi[d]);
+      auto xv = geometry.x_at(mesh.topology().conn()[cell][v]);
+      for (int d = 0; d < 3; d++) x[d] += w * xv[d];
+    }
+    auto location = locator.locate_point(x);
+    ASSERT_EQ(location.cell, cell);
+    for (int d = 0; d < 3; d++) EXPECT_NEAR(location.ref[d], xi[d], 1e-10);
+  }
+  EXPECT_EQ(locator.locate_point(std::vector<double>{0.5, 0.5, 1.2}).cell, NOT_FOUND);
+}
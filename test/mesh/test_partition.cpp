@@ -0,0 +1,109 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/partition.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/test_meshes.hpp"
+
+using namespace oiseau::mesh;
+
+namespace {
+
+// n x n quadrilateral grid on the unit square, bottom edge tagged 1.
+Mesh quad_mesh(std::size_t n) {
+  Mesh mesh = oiseau::test::grid_mesh(CellKind::Quadrilateral, n, 3, {.bottom = 1});
+  mesh.topology().calculate_connectivity();
+  return mesh;
+}
+
+}  // namespace
+
+TEST(test_partition, hilbert_partition_quality) {
+  Mesh mesh = quad_mesh(16);
+  auto parts = partition_cells(mesh, 4);
+  auto quality = partition_quality(mesh.topology(), parts, 4);
+
+  EXPECT_EQ(quality.part_sizes.size(), 4);
+  for (auto size : quality.part_sizes) EXPECT_GT(size, 0);
+  EXPECT_LE(quality.imbalance, 1.05);
+  // four 8x8 quadrants cut 32 faces
+  EXPECT_LE(quality.edge_cut, 40);
+}
+
+TEST(test_partition, single_part) {
+  Mesh mesh = quad_mesh(4);
+  auto parts = partition_cells(mesh, 1);
+  auto quality = partition_quality(mesh.topology(), parts, 1);
+  EXPECT_EQ(quality.edge_cut, 0);
+  EXPECT_DOUBLE_EQ(quality.imbalance, 1.0);
+}
+
+TEST(test_partition, submesh_ghost_layers) {
+  Mesh mesh = quad_mesh(8);
+  auto parts = partition_cells(mesh, 3);
+  auto subs = extract_submeshes(mesh, parts, 3, 1);
+
+  std::size_t n_owned = 0;
+  for (const auto& sub : subs) {
+    n_owned += sub.n_owned_cells;
+    const auto& topology = sub.mesh.topology();
+    ASSERT_EQ(topology.n_cells(), sub.local_to_global_cells.size());
+    ASSERT_EQ(sub.ghost_owners.size(), topology.n_cells() - sub.n_owned_cells);
+
+    for (std::size_t l = 0; l < topology.n_cells(); l++) {
+      std::size_t g = sub.local_to_global_cells[l];
+      EXPECT_EQ(parts[g] == sub.rank, l < sub.n_owned_cells);
+      if (l >= sub.n_owned_cells) {
+        EXPECT_EQ(sub.ghost_owners[l - sub.n_owned_cells], parts[g]);
+      }
+      // local nodes map back to the global cell vertices
+      for (std::size_t v = 0; v < 4; v++) {
+        EXPECT_EQ(sub.local_to_global_nodes[topology.conn()[l][v]], mesh.topology().conn()[g][v]);
+      }
+    }
+    // with one ghost layer every interior face of an owned cell stays interior
+    for (std::size_t l = 0; l < sub.n_owned_cells; l++) {
+      std::size_t g = sub.local_to_global_cells[l];
+      for (std::size_t j = 0; j < 4; j++) {
+        bool global_boundary = mesh.topology().e_to_e()[g][j] == g;
+        bool local_boundary = topology.e_to_e()[l][j] == l;
+        EXPECT_EQ(global_boundary, local_boundary);
+      }
+    }
+    for (auto v : sub.mesh.geometry().x()) EXPECT_LE(v, 1.0);
+  }
+  EXPECT_EQ(n_owned, 64);
+}
+
+TEST(test_partition, submesh_keeps_tagged_facets) {
+  Mesh mesh = quad_mesh(4);
+  std::vector<int> parts(16, 1);
+  for (std::size_t i = 0; i < 4; i++) parts[i] = 0;
+  auto sub = extract_submesh(mesh, parts, 1, 0);
+  EXPECT_EQ(sub.n_owned_cells, 12);
+  EXPECT_TRUE(sub.ghost_owners.empty());
+  EXPECT_TRUE(sub.mesh.topology().boundary_facets().empty());
+
+  auto sub0 = extract_submesh(mesh, parts, 0, 2);
+  EXPECT_EQ(sub0.mesh.topology().n_cells(), 12);
+  EXPECT_EQ(sub0.mesh.topology().boundary_facets().size(), 4);
+}
+
+TEST(test_partition, requires_connectivity) {
+  Topology topology({{0, 1, 2}}, {get_cell_type(CellKind::Triangle)});
+  Mesh mesh(std::move(topology), Geometry({0, 0, 0, 1, 0, 0, 0, 1, 0}, 3));
+  EXPECT_THROW(partition_cells(mesh, 2), std::runtime_error);
+}
@@ -0,0 +1,139 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/refine.hpp"
+#include "oiseau/mesh/topology.hpp"
+
+using namespace oiseau::mesh;
+
+namespace {
+
+Mesh make_mesh(std::vector<double>&& x, std::vector<std::vector<std::size_t>>&& conn,
+               CellKind kind) {
+  std::vector<CellType> cell_types(conn.size(), get_cell_type(kind));
+  return Mesh(Topology(std::move(conn), std::move(cell_types)), Geometry(std::move(x), 3));
+}
+
+std::array<double, 3> sub(std::span<const double> a, std::span<const double> b) {
+  return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+}
+
+// Signed area (2D, z = 0) or volume of a simplex.
+double simplex_measure(const Mesh& mesh, const std::vector<std::size_t>& cell) {
+  const auto& g = mesh.geometry();
+  auto a = sub(g.x_at(cell[1]), g.x_at(cell[0]));
+  auto b = sub(g.x_at(cell[2]), g.x_at(cell[0]));
+  if (cell.size() == 3) return 0.5 * (a[0] * b[1] - a[1] * b[0]);
+  auto c = sub(g.x_at(cell[3]), g.x_at(cell[0]));
+  return (a[0] * (b[1] * c[2] - b[2] * c[1]) - a[1] * (b[0] * c[2] - b[2] * c[0]) +
+          a[2] * (b[0] * c[1] - b[1] * c[0])) /
+         6.0;
+}
+
+std::size_t count_boundary_faces(Topology& topology) {
+  topology.calculate_connectivity();
+  std::size_t n = 0;
+  for (std::size_t i = 0; i < topology.n_cells(); i++) {
+    for (auto k : topology.e_to_e()[i]) n += (k == i);
+  }
+  return n;
+}
+
+}  // namespace
+
+TEST(test_refine, triangles) {
+  Mesh mesh = make_mesh({0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0}, {{0, 1, 2}, {0, 2, 3}},
+                        CellKind::Triangle);
+  mesh.topology().set_boundary_facets({{0, 1}, {1, 2}, {2, 3}, {3, 0}}, {1, 2, 3, 4});
+  Mesh refined = refine_uniform(mesh);
+
+  EXPECT_EQ(refined.topology().n_cells(), 8);
+  EXPECT_EQ(refined.geometry().n_nodes(), 9);
+  for (const auto& cell : refined.topology().conn()) {
+    EXPECT_DOUBLE_EQ(simplex_measure(refined, cell), 0.125);
+  }
+  EXPECT_EQ(count_boundary_faces(refined.topology()), 8);
+
+  auto facet_tags = refined.topology().boundary_facet_tags();
+  EXPECT_EQ(std::vector<int>(facet_tags.begin(), facet_tags.end()),
+            std::vector<int>({1, 1, 2, 2, 3, 3, 4, 4}));
+  std::size_t tagged = 0;
+  for (const auto& tags : refined.topology().facet_tags()) {
+    for (auto tag : tags) tagged += (tag != UNTAGGED);
+  }
+  EXPECT_EQ(tagged, 8);
+
+  Mesh twice = refine_uniform(refined);
+  EXPECT_EQ(twice.topology().n_cells(), 32);
+  EXPECT_EQ(twice.geometry().n_nodes(), 25);
+  EXPECT_EQ(count_boundary_faces(twice.topology()), 16);
+}
+
+TEST(test_refine, quadrilaterals) {
+  Mesh mesh = make_mesh({0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 1, 0, 1, 1, 0, 2, 1, 0},
+                        {{0, 1, 4, 3}, {1, 2, 5, 4}}, CellKind::Quadrilateral);
+  Mesh refined = refine_uniform(mesh);
+  EXPECT_EQ(refined.topology().n_cells(), 8);
+  EXPECT_EQ(refined.geometry().n_nodes(), 15);
+  EXPECT_EQ(count_boundary_faces(refined.topology()), 12);
+
+  // children are counter-clockwise unit-half squares, like their parent
+  for (const auto& cell : refined.topology().conn()) {
+    auto x0 = refined.geometry().x_at(cell[0]);
+    auto x2 = refined.geometry().x_at(cell[2]);
+    EXPECT_DOUBLE_EQ(x2[0] - x0[0], 0.5);
+    EXPECT_DOUBLE_EQ(x2[1] - x0[1], 0.5);
+  }
+}
+
+TEST(test_refine, tetrahedron) {
+  Mesh mesh = make_mesh({0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1}, {{0, 1, 2, 3}},
+                        CellKind::Tetrahedron);
+  mesh.topology().set_boundary_facets({{1, 2, 3}}, {5});
+  Mesh refined = refine_uniform(mesh);
+  EXPECT_EQ(refined.topology().n_cells(), 8);
+  EXPECT_EQ(refined.geometry().n_nodes(), 10);
+  for (const auto& cell : refined.topology().conn()) {
+    EXPECT_NEAR(simplex_measure(refined, cell), 1.0 / 48.0, 1e-15);
+  }
+  EXPECT_EQ(count_boundary_faces(refined.topology()), 16);
+  EXPECT_EQ(refined.topology().boundary_facets().size(), 4);
+}
+
+TEST(test_refine, hexahedra) {
+  Mesh mesh = make_mesh({0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1,
+                         2, 0, 0, 2, 1, 0, 2, 0, 1, 2, 1, 1},
+                        {{0, 1, 2, 3, 4, 5, 6, 7}, {1, 8, 9, 2, 5, 10, 11, 6}},
+                        CellKind::Hexahedron);
+  mesh.topology().set_boundary_facets({{1, 8, 10, 5}}, {3});
+  Mesh refined = refine_uniform(mesh);
+  EXPECT_EQ(refined.topology().n_cells(), 16);
+  EXPECT_EQ(refined.geometry().n_nodes(), 45);
+  EXPECT_EQ(count_boundary_faces(refined.topology()), 40);
+  EXPECT_EQ(refined.topology().boundary_facets().size(), 4);
+
+  // children are axis-aligned half cubes with the parent's vertex ordering
+  const std::array<std::array<double, 3>, 8> corners = {
+      {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}}};
+  for (const auto& cell : refined.topology().conn()) {
+    auto x0 = refined.geometry().x_at(cell[0]);
+    for (std::size_t v = 0; v < 8; v++) {
+      auto xv = refined.geometry().x_at(cell[v]);
+      for (std::size_t d = 0; d < 3; d++) EXPECT_DOUBLE_EQ(xv[d] - x0[d], 0.5 * corners[v][d]);
+    }
+  }
+}
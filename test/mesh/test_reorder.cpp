@@ -0,0 +1,143 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/reorder.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/test_meshes.hpp"
+
+using namespace oiseau::mesh;
+
+namespace {
+
+// n x n quadrilateral grid on the unit square with cells and nodes randomly shuffled.
+Mesh shuffled_quad_mesh(std::size_t n) {
+  return oiseau::test::shuffled_mesh(oiseau::test::grid_mesh(CellKind::Quadrilateral, n));
+}
+
+std::array<double, 2> centroid(const Mesh& mesh, std::size_t cell) {
+  std::array<double, 2> c{0.0, 0.0};
+  for (auto v : mesh.topology().conn()[cell]) {
+    c[0] += mesh.geometry().x_at(v)[0] / 4;
+    c[1] += mesh.geometry().x_at(v)[1] / 4;
+  }
+  return c;
+}
+
+std::size_t bandwidth(const Topology& topology) {
+  std::size_t bw = 0;
+  for (std::size_t i = 0; i < topology.n_cells(); i++) {
+    for (auto k : topology.e_to_e()[i]) bw = std::max(bw, i > k ? i - k : k - i);
+  }
+  return bw;
+}
+
+bool is_permutation(std::vector<std::size_t> p) {
+  std::ranges::sort(p);
+  for (std::size_t i = 0; i < p.size(); i++) {
+    if (p[i] != i) return false;
+  }
+  return true;
+}
+
+void expect_consistent_reorder(ReorderMethod method) {
+  Mesh original = shuffled_quad_mesh(16);
+  Mesh mesh = original;
+  auto perm = reorder(mesh, method);
+
+  ASSERT_EQ(perm.cell_new_to_old.size(), 256);
+  ASSERT_EQ(perm.node_new_to_old.size(), 289);
+  EXPECT_TRUE(is_permutation(perm.cell_new_to_old));
+  EXPECT_TRUE(is_permutation(perm.node_new_to_old));
+  for (std::size_t i = 0; i < 256; i++) {
+    EXPECT_EQ(perm.cell_old_to_new[perm.cell_new_to_old[i]], i);
+    EXPECT_EQ(centroid(mesh, i), centroid(original, perm.cell_new_to_old[i]));
+  }
+
+  // the permuted connectivity matches a fresh computation on the reordered mesh
+  Topology fresh = mesh.topology();
+  fresh.calculate_connectivity();
+  for (std::size_t i = 0; i < 256; i++) {
+    EXPECT_EQ(mesh.topology().e_to_e()[i], fresh.e_to_e()[i]);
+    EXPECT_EQ(mesh.topology().e_to_f()[i], fresh.e_to_f()[i]);
+  }
+}
+
+}  // namespace
+
+TEST(test_reorder, hilbert_key_is_continuous) {
+  std::vector<std::pair<std::uint64_t, std::array<int, 3>>> points;
+  for (std::uint32_t z = 0; z < 8; z++) {
+    for (std::uint32_t y = 0; y < 8; y++) {
+      for (std::uint32_t x = 0; x < 8; x++) {
+        points.push_back({hilbert_key(x, y, z), {int(x), int(y), int(z)}});
+      }
+    }
+  }
+  std::ranges::sort(points);
+  for (std::size_t i = 0; i < points.size(); i++) {
+    EXPECT_EQ(points[i].first, i);
+    if (i == 0) continue;
+    auto [a, b] = std::pair{points[i - 1].second, points[i].second};
+    EXPECT_EQ(std::abs(a[0] - b[0]) + std::abs(a[1] - b[1]) + std::abs(a[2] - b[2]), 1);
+  }
+}
+
+TEST(test_reorder, morton_key_interleaves_bits) {
+  EXPECT_EQ(morton_key(0, 0, 0), 0);
+  EXPECT_EQ(morton_key(0, 0, 1), 1);
+  EXPECT_EQ(morton_key(0, 1, 0), 2);
+  EXPECT_EQ(morton_key(1, 0, 0), 4);
+  EXPECT_EQ(morton_key(3, 3, 3), 63);
+}
+
+TEST(test_reorder, rcm_reduces_bandwidth) {
+  Mesh mesh = shuffled_quad_mesh(16);
+  mesh.topology().calculate_connectivity();
+  std::size_t before = bandwidth(mesh.topology());
+  reorder(mesh, ReorderMethod::ReverseCuthillMcKee);
+  EXPECT_LE(bandwidth(mesh.topology()), 17);
+  EXPECT_LT(bandwidth(mesh.topology()), before);
+}
+
+TEST(test_reorder, reorder_is_consistent) {
+  expect_consistent_reorder(ReorderMethod::ReverseCuthillMcKee);
+  expect_consistent_reorder(ReorderMethod::Hilbert);
+  expect_consistent_reorder(ReorderMethod::Morton);
+}
+
+TEST(test_reorder, rcm_requires_connectivity) {
+  Mesh mesh = shuffled_quad_mesh(2);
+  EXPECT_THROW(rcm_ordering(mesh.topology()), std::runtime_error);
+}
+
+TEST(test_reorder, reorders_planar_geometry) {
+  auto grid = oiseau::test::grid_mesh(CellKind::Quadrilateral, 4, 2);
+  Mesh original = oiseau::test::shuffled_mesh(grid);
+  Mesh mesh = original;
+  auto perm = reorder(mesh, ReorderMethod::Hilbert);
+  ASSERT_EQ(mesh.geometry().n_nodes(), 25);
+  for (std::size_t v = 0; v < mesh.geometry().n_nodes(); v++) {
+    ASSERT_EQ(mesh.geometry().x_at(v).size(), 2);
+    EXPECT_TRUE(std::ranges::equal(mesh.geometry().x_at(v),
+                                   original.geometry().x_at(perm.node_new_to_old[v])));
+  }
+}
@@ -0,0 +1,65 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/topology.hpp"
+
+using namespace oiseau::mesh;
+
+TEST(test_topology, connectivity_mixed_triangle_quadrilateral) {
+  auto tri = get_cell_type(CellKind::Triangle);
+  auto quad = get_cell_type(CellKind::Quadrilateral);
+  std::vector<std::vector<std::size_t>> conn = {{0, 1, 2}, {0, 2, 3}, {1, 4, 5, 2}};
+  Topology topology(std::move(conn), {tri, tri, quad});
+  topology.calculate_connectivity();
+
+  auto e_to_e = topology.e_to_e();
+  auto e_to_f = topology.e_to_f();
+  EXPECT_EQ(e_to_e[0], std::vector<std::size_t>({2, 1, 0}));
+  EXPECT_EQ(e_to_f[0], std::vector<std::size_t>({3, 2, 2}));
+  EXPECT_EQ(e_to_e[1], std::vector<std::size_t>({1, 1, 0}));
+  EXPECT_EQ(e_to_f[1], std::vector<std::size_t>({0, 1, 1}));
+  EXPECT_EQ(e_to_e[2], std::vector<std::size_t>({2, 2, 2, 0}));
+  EXPECT_EQ(e_to_f[2], std::vector<std::size_t>({0, 1, 2, 0}));
+}
+
+TEST(test_topology, connectivity_tetrahedra_hexahedron) {
+  auto hex = get_cell_type(CellKind::Hexahedron);
+  auto tet = get_cell_type(CellKind::Tetrahedron);
+  std::vector<std::vector<std::size_t>> conn = {
+      {0, 1, 2, 3, 4, 5, 6, 7}, {1, 8, 2, 5}, {5, 2, 8, 11}};
+  Topology topology(std::move(conn), {hex, tet, tet});
+  topology.calculate_connectivity();
+
+  auto e_to_e = topology.e_to_e();
+  auto e_to_f = topology.e_to_f();
+  EXPECT_EQ(e_to_e[0], std::vector<std::size_t>(6, 0));
+  EXPECT_EQ(e_to_e[1], std::vector<std::size_t>({2, 1, 1, 1}));
+  EXPECT_EQ(e_to_f[1][0], 3);
+  EXPECT_EQ(e_to_e[2], std::vector<std::size_t>({2, 2, 2, 1}));
+  EXPECT_EQ(e_to_f[2][3], 0);
+}
+
+TEST(test_topology, facet_tags_from_boundary_facets) {
+  auto tri = get_cell_type(CellKind::Triangle);
+  std::vector<std::vector<std::size_t>> conn = {{0, 1, 2}, {0, 2, 3}};
+  Topology topology(std::move(conn), {tri, tri}, {7, 8});
+  topology.set_boundary_facets({{1, 0}, {3, 2}}, {11, 12});
+  topology.calculate_connectivity();
+
+  auto cell_tags = topology.cell_tags();
+  EXPECT_EQ(cell_tags[0], 7);
+  EXPECT_EQ(cell_tags[1], 8);
+  auto tags = topology.facet_tags();
+  EXPECT_EQ(tags[0], std::vector<int>({UNTAGGED, UNTAGGED, 11}));
+  EXPECT_EQ(tags[1], std::vector<int>({12, UNTAGGED, UNTAGGED}));
+}
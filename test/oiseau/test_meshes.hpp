@@ -0,0 +1,162 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/topology.hpp"
+
+namespace oiseau::test {
+
+/// Tags of the facets on the first and last layer along the last axis (y in 2D, z in 3D).
+struct GridSides {
+  int bottom = mesh::UNTAGGED;
+  int top = mesh::UNTAGGED;
+};
+
+/**
+ * @brief Structured n x n (x n) grid on the unit square or cube.
+ *
+ * Triangles split each square into two and tetrahedra split each cube into six along its main
+ * diagonal (Kuhn subdivision). Nodes are numbered lexicographically, x fastest, and stored with
+ * `gdim` coordinates. Connectivity is left for the caller to compute.
+ */
+inline mesh::Mesh grid_mesh(mesh::CellKind kind, std::size_t n, unsigned gdim = 3,
+                            GridSides sides = {}) {
+  const bool solid = kind == mesh::CellKind::Tetrahedron || kind == mesh::CellKind::Hexahedron;
+  if (!solid && kind != mesh::CellKind::Triangle && kind != mesh::CellKind::Quadrilateral) {
+    throw std::invalid_argument("Unsupported grid cell kind");
+  }
+  const std::size_t tdim = solid ? 3 : 2;
+  if (gdim < tdim) throw std::invalid_argument("Grid needs at least one coordinate per axis");
+
+  const std::size_t nk = solid ? n : 0;
+  auto node = [n](std::size_t i, std::size_t j, std::size_t k) {
+    return (k * (n + 1) + j) * (n + 1) + i;
+  };
+  std::vector<double> x((n + 1) * (n + 1) * (nk + 1) * gdim, 0.0);
+  for (std::size_t k = 0; k <= nk; k++) {
+    for (std::size_t j = 0; j <= n; j++) {
+      for (std::size_t i = 0; i <= n; i++) {
+        const std::array<std::size_t, 3> ijk = {i, j, k};
+        for (std::size_t d = 0; d < tdim; d++) {
+          x[node(i, j, k) * gdim + d] = static_cast<double>(ijk[d]) / n;
+        }
+      }
+    }
+  }
+
+  constexpr std::array<std::array<int, 3>, 6> axis_orders = {
+      {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}}};
+  std::vector<std::vector<std::size_t>> conn;
+  for (std::size_t k = 0; k < std::max<std::size_t>(nk, 1); k++) {
+    for (std::size_t j = 0; j < n; j++) {
+      for (std::size_t i = 0; i < n; i++) {
+        switch (kind) {
+        case mesh::CellKind::Triangle:
+          conn.push_back({node(i, j, 0), node(i + 1, j, 0), node(i, j + 1, 0)});
+          conn.push_back({node(i + 1, j + 1, 0), node(i, j + 1, 0), node(i + 1, j, 0)});
+          break;
+        case mesh::CellKind::Quadrilateral:
+          conn.push_back({node(i, j, 0), node(i + 1, j, 0), node(i + 1, j + 1, 0),
+                          node(i, j + 1, 0)});
+          break;
+        case mesh::CellKind::Hexahedron:
+          conn.push_back({node(i, j, k), node(i + 1, j, k), node(i + 1, j + 1, k),
+                          node(i, j + 1, k), node(i, j, k + 1), node(i + 1, j, k + 1),
+                          node(i + 1, j + 1, k + 1), node(i, j + 1, k + 1)});
+          break;
+        default:
+          for (const auto& axes : axis_orders) {
+            std::array<std::size_t, 3> p = {i, j, k};
+            std::vector<std::size_t> tet = {node(i, j, k)};
+            for (auto a : axes) {
+              p[a]++;
+              tet.push_back(node(p[0], p[1], p[2]));
+            }
+            conn.push_back(std::move(tet));
+          }
+        }
+      }
+    }
+  }
+
+  // facets of the layer at the given index of the last axis
+  auto side = [&](std::size_t l) {
+    std::vector<std::vector<std::size_t>> facets;
+    for (std::size_t j = 0; j < (solid ? n : 1); j++) {
+      for (std::size_t i = 0; i < n; i++) {
+        if (!solid) {
+          facets.push_back({node(i, l, 0), node(i + 1, l, 0)});
+        } else if (kind == mesh::CellKind::Hexahedron) {
+          facets.push_back({node(i, j, l), node(i + 1, j, l), node(i + 1, j + 1, l),
+                            node(i, j + 1, l)});
+        } else {
+          facets.push_back({node(i, j, l), node(i + 1, j, l), node(i + 1, j + 1, l)});
+          facets.push_back({node(i, j, l), node(i, j + 1, l), node(i + 1, j + 1, l)});
+        }
+      }
+    }
+    return facets;
+  };
+
+  std::vector<mesh::CellType> cell_types(conn.size(), mesh::get_cell_type(kind));
+  mesh::Topology topology(std::move(conn), std::move(cell_types));
+  std::vector<std::vector<std::size_t>> facets;
+  std::vector<int> tags;
+  for (auto [l, tag] : {std::pair{std::size_t{0}, sides.bottom}, std::pair{n, sides.top}}) {
+    if (tag == mesh::UNTAGGED) continue;
+    for (auto& f : side(l)) {
+      facets.push_back(std::move(f));
+      tags.push_back(tag);
+    }
+  }
+  if (!facets.empty()) topology.set_boundary_facets(std::move(facets), std::move(tags));
+  return mesh::Mesh(std::move(topology), mesh::Geometry(std::move(x), gdim));
+}
+
+/// Copy of `mesh` with nodes and cells in random order, as an unordered mesher would output.
+inline mesh::Mesh shuffled_mesh(const mesh::Mesh& mesh, unsigned seed = 42) {
+  std::mt19937 rng(seed);
+  const auto& geometry = mesh.geometry();
+  const unsigned gdim = geometry.dim();
+  std::vector<std::size_t> node_perm(geometry.x().size() / gdim);
+  std::iota(node_perm.begin(), node_perm.end(), 0);
+  std::ranges::shuffle(node_perm, rng);
+
+  std::vector<double> x(geometry.x().size());
+  for (std::size_t v = 0; v < node_perm.size(); v++) {
+    std::ranges::copy(geometry.x_at(v), x.begin() + node_perm[v] * gdim);
+  }
+  const auto& topology = mesh.topology();
+  std::vector<std::size_t> cell_perm(topology.n_cells());
+  std::iota(cell_perm.begin(), cell_perm.end(), 0);
+  std::ranges::shuffle(cell_perm, rng);
+
+  std::vector<std::vector<std::size_t>> conn;
+  std::vector<mesh::CellType> cell_types;
+  for (auto c : cell_perm) {
+    auto cell = topology.conn()[c];
+    for (auto& v : cell) v = node_perm[v];
+    conn.push_back(std::move(cell));
+    cell_types.push_back(topology.cell_types()[c]);
+  }
+  return mesh::Mesh(mesh::Topology(std::move(conn), std::move(cell_types)),
+                    mesh::Geometry(std::move(x), gdim));
+}
+
+}  // namespace oiseau::test
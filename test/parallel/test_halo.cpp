@@ -0,0 +1,109 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "oiseau/mesh/cell.hpp"
+#include "oiseau/mesh/geometry.hpp"
+#include "oiseau/mesh/mesh.hpp"
+#include "oiseau/mesh/partition.hpp"
+#include "oiseau/mesh/topology.hpp"
+#include "oiseau/parallel/halo.hpp"
+#include "oiseau/parallel/transport.hpp"
+#include "oiseau/test_meshes.hpp"
+
+using namespace oiseau;
+
+TEST(test_halo, threaded_transport_ring) {
+  parallel::run_threaded(4, [](parallel::Transport& transport) {
+    int rank = transport.rank();
+    int size = transport.size();
+    std::vector<int> out = {rank, 10 * rank};
+    std::vector<int> in(2, -1);
+    auto recv = transport.irecv((rank + size - 1) % size, 7, std::span(in));
+    auto send = transport.isend((rank + 1) % size, 7, std::span<const int>(out));
+    transport.wait(send);
+    transport.wait(recv);
+    int left = (rank + size - 1) % size;
+    EXPECT_EQ(in, std::vector<int>({left, 10 * left}));
+    transport.barrier();
+  });
+}
+
+TEST(test_halo, threaded_transport_propagates_errors) {
+  EXPECT_THROW(parallel::run_threaded(2,
+                                      [](parallel::Transport& transport) {
+                                        std::vector<double> in(3);
+                                        std::vector<double> out(2, 1.0);
+                                        int peer = 1 - transport.rank();
+                                        auto recv = transport.irecv(peer, 0, std::span(in));
+                                        transport.isend(peer, 0, std::span<const double>(out));
+                                        transport.wait(recv);
+                                      }),
+               std::runtime_error);
+}
+
+TEST(test_halo, threaded_transport_failure_releases_peers) {
+  // rank 1 waits for a message rank 0 never sends, rank 2 for a barrier rank 0 never reaches
+  EXPECT_THROW(parallel::run_threaded(3,
+                                      [](parallel::Transport& transport) {
+                                        if (transport.rank() == 0) {
+                                          throw std::logic_error("rank 0 failed");
+                                        }
+                                        if (transport.rank() == 1) {
+                                          std::vector<int> in(1);
+                                          transport.wait(transport.irecv(0, 0, std::span(in)));
+                                        }
+                                        transport.barrier();
+                                      }),
+               std::logic_error);
+}
+
+TEST(test_halo, ghost_values_match_owners) {
+  constexpr int n_ranks = 4;
+  constexpr std::size_t np = 3;
+  mesh::Mesh global = test::grid_mesh(mesh::CellKind::Quadrilateral, 8);
+  global.topology().calculate_connectivity();
+  auto parts = mesh::partition_cells(global, n_ranks);
+  auto subs = mesh::extract_submeshes(global, parts, n_ranks);
+  std::atomic<std::size_t> n_interface = 0;
+
+  parallel::run_threaded(n_ranks, [&](parallel::Transport& transport) {
+    const auto& sub = subs[transport.rank()];
+    const std::size_t n_local = sub.local_to_global_cells.size();
+    std::vector<std::size_t> offsets(n_local + 1);
+    for (std::size_t l = 0; l <= n_local; l++) offsets[l] = l * np;
+
+    parallel::HaloExchange halo(sub, offsets, transport);
+    EXPECT_EQ(halo.recv_size(), (n_local - sub.n_owned_cells) * np);
+    EXPECT_EQ(halo.interior_cells().size() + halo.interface_cells().size(), sub.n_owned_cells);
+    n_interface += halo.interface_cells().size();
+
+    std::vector<double> u(n_local * np, -1.0);
+    for (int round = 0; round < 2; round++) {
+      for (std::size_t l = 0; l < sub.n_owned_cells; l++) {
+        for (std::size_t k = 0; k < np; k++) {
+          u[l * np + k] = 100.0 * round + 10.0 * sub.local_to_global_cells[l] + k;
+        }
+      }
+      halo.begin(u);
+      halo.end(u);
+      for (std::size_t l = sub.n_owned_cells; l < n_local; l++) {
+        for (std::size_t k = 0; k < np; k++) {
+          EXPECT_EQ(u[l * np + k], 100.0 * round + 10.0 * sub.local_to_global_cells[l] + k);
+        }
+      }
+    }
+  });
+  EXPECT_GT(n_interface.load(), 0);
+}
@@ -0,0 +1,144 @@
+// Copyright (C) 2025 Tiago V. L. Amorim (@tiagovla)
+//
+// This file is part of oiseau (https://github.com/tiagovla/oiseau)
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <xtensor/containers/xarray.hpp>
+
+#include "oiseau/plotting/pyplot.hpp"
+
+namespace {
+
+int n_holders = 0;
+
+// a C++ object owning an array, exposed to Python by reference
+struct Holder {
+  Holder() { ++n_holders; }
+  Holder(const Holder &) = delete;
+  ~Holder() { --n_holders; }
+  xt::xarray<double> values = {{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+};
+
+}  // namespace
+
+PYBIND11_EMBEDDED_MODULE(xarray_caster, m) {
+  py::class_<Holder>(m, "Holder")
+      .def(py::init<>())
+      .def(
+          "values", [](Holder &h) -> xt::xarray<double> & { return h.values; },
+          py::return_value_policy::reference_internal)
+      .def(
+          "const_values", [](const Holder &h) -> const xt::xarray<double> & { return h.values; },
+          py::return_value_policy::reference_internal);
+  m.def("round_trip", [](xt::xarray<double> a) { return a; });
+  m.def("size", [](const xt::xarray<double> &a) { return a.size(); }, py::arg("a").noconvert());
+}
+
+class test_pyplot_caster : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() { interpreter = std::make_unique<py::scoped_interpreter>(); }
+  static void TearDownTestSuite() { interpreter.reset(); }
+
+  void SetUp() override {
+    try {
+      np = py::module_::import("numpy");
+    } catch (const py::error_already_set &) {
+      GTEST_SKIP() << "NumPy is not available";
+    }
+    caster = py::module_::import("xarray_caster");
+  }
+
+  static void collect() { py::module_::import("gc").attr("collect")(); }
+  static bool writeable(const py::handle &a) {
+    return a.attr("flags").attr("writeable").cast<bool>();
+  }
+
+  static inline std::unique_ptr<py::scoped_interpreter> interpreter;
+  py::module_ np;
+  py::module_ caster;
+};
+
+TEST_F(test_pyplot_caster, rvalue_outlives_its_source) {
+  py::object obj;
+  const double *data = nullptr;
+  {
+    xt::xarray<double> src = {{1.0, 2.0}, {3.0, 4.0}};
+    data = src.data();
+    obj = py::cast(std::move(src));
+  }
+  collect();
+  auto arr = py::reinterpret_borrow<py::array>(obj);
+  // the buffer was moved into the array, not copied
+  EXPECT_EQ(arr.data(), data);
+  EXPECT_TRUE(writeable(arr));
+  EXPECT_DOUBLE_EQ(np.attr("sum")(arr).cast<double>(), 10.0);
+  EXPECT_EQ(arr.shape(0), 2);
+  EXPECT_EQ(arr.shape(1), 2);
+}
+
+TEST_F(test_pyplot_caster, reference_internal_keeps_parent_alive) {
+  {
+    py::object holder = caster.attr("Holder")();
+    ASSERT_EQ(n_holders, 1);
+    auto values = py::reinterpret_borrow<py::array>(holder.attr("values")());
+    auto const_values = py::reinterpret_borrow<py::array>(holder.attr("const_values")());
+    EXPECT_TRUE(writeable(values));
+    EXPECT_EQ(values.data(), holder.cast<Holder &>().values.data());
+
+    // both views alias the holder's memory
+    values.attr("__setitem__")(py::make_tuple(1, 2), 60.0);
+    EXPECT_DOUBLE_EQ(holder.cast<Holder &>().values(1, 2), 60.0);
+    EXPECT_DOUBLE_EQ(const_values.attr("__getitem__")(py::make_tuple(1, 2)).cast<double>(), 60.0);
+
+    holder = py::none();
+    collect();
+    EXPECT_EQ(n_holders, 1);
+    EXPECT_DOUBLE_EQ(np.attr("sum")(values).cast<double>(), 75.0);
+  }
+  collect();
+  EXPECT_EQ(n_holders, 0);
+}
+
+TEST_F(test_pyplot_caster, const_lvalue_is_read_only) {
+  py::object holder = caster.attr("Holder")();
+  auto view = py::reinterpret_borrow<py::array>(holder.attr("const_values")());
+  EXPECT_FALSE(writeable(view));
+  EXPECT_THROW(view.attr("__setitem__")(py::make_tuple(0, 0), 1.0), py::error_already_set);
+
+  const xt::xarray<double> src = {1.0, 2.0, 3.0};
+  auto ref = py::reinterpret_borrow<py::array>(py::cast(src, py::return_value_policy::reference));
+  EXPECT_FALSE(writeable(ref));
+  EXPECT_EQ(ref.data(), src.data());
+
+  // any other policy hands Python its own copy
+  auto copy = py::reinterpret_borrow<py::array>(py::cast(src));
+  EXPECT_TRUE(writeable(copy));
+  EXPECT_NE(copy.data(), src.data());
+}
+
+TEST_F(test_pyplot_caster, loads_strided_and_integer_arrays) {
+  py::dict locals;
+  locals["np"] = np;
+  py::object ints = py::eval("np.arange(12).reshape(3, 4)", py::globals(), locals);
+  locals["ints"] = ints;
+  py::object strided = py::eval("ints[:, ::2].T", py::globals(), locals);
+
+  py::object out = caster.attr("round_trip")(strided);
+  EXPECT_EQ(out.attr("dtype").attr("name").cast<std::string>(), "float64");
+  EXPECT_TRUE(out.attr("shape").equal(py::make_tuple(2, 3)));
+  EXPECT_TRUE(np.attr("array_equal")(out, strided).cast<bool>());
+
+  // without conversion only float64 arrays are accepted
+  EXPECT_THROW(caster.attr("size")(ints), py::error_already_set);
+  EXPECT_EQ(caster.attr("size")(np.attr("ones")(4)).cast<std::size_t>(), 4);
+  EXPECT_EQ(caster.attr("size")(py::eval("np.ones((4, 6))[::2, ::3]", py::globals(), locals))
+                .cast<std::size_t>(),
+            4);
+}
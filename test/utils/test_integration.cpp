@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <cstddef>
 #include <stdexcept>
 #include <xtensor/core/xmath.hpp>
 #include <xtensor/views/xview.hpp>
@@ -32,6 +33,43 @@ double integral_triangle_xn_ym(int n, int m) {
   return I1 + I2;
 }
 
+double factorial(int n) { return std::tgamma(n + 1.0); }
+
+// x^a y^b z^c over the reference tetrahedron, expanding x = 2u - 1 on the unit simplex
+double integral_tetrahedron(int a, int b, int c) {
+  auto binomial = [](int n, int k) { return factorial(n) / (factorial(k) * factorial(n - k)); };
+  double sum = 0.0;
+  for (int p = 0; p <= a; ++p) {
+    for (int q = 0; q <= b; ++q) {
+      for (int r = 0; r <= c; ++r) {
+        double coefficient = binomial(a, p) * binomial(b, q) * binomial(c, r) *
+                             std::pow(2.0, p + q + r) * std::pow(-1.0, a + b + c - p - q - r);
+        sum += coefficient * factorial(p) * factorial(q) * factorial(r) / factorial(p + q + r + 3);
+      }
+    }
+  }
+  return 8.0 * sum;
+}
+
+template <typename Exact>
+void expect_exact_3d(const oiseau::utils::integration::CubatureRule& rule, int order,
+                     Exact exact, double tol) {
+  ASSERT_EQ(rule.dim, 3);
+  for (int a = 0; a <= order; ++a) {
+    for (int b = 0; a + b <= order; ++b) {
+      for (int c = 0; a + b + c <= order; ++c) {
+        double sum = 0.0;
+        for (std::size_t k = 0; k < rule.size(); ++k) {
+          sum += rule.weights[k] * std::pow(rule.nodes[3 * k], a) *
+                 std::pow(rule.nodes[3 * k + 1], b) * std::pow(rule.nodes[3 * k + 2], c);
+        }
+        EXPECT_NEAR(exact(a, b, c), sum, tol)
+            << "Failed for order " << order << " with x^" << a << " y^" << b << " z^" << c;
+      }
+    }
+  }
+}
+
 }  // namespace
 
 TEST(test_integration, test_gauss_quadrature) {
@@ -73,3 +111,43 @@ TEST(test_integration, test_quadrature_zero_and_negative) {
   EXPECT_THROW(oiseau::utils::integration::quadrature(-1), std::out_of_range);
   EXPECT_THROW(oiseau::utils::integration::quadrature(0), std::out_of_range);
 }
+
+TEST(test_integration, test_cubature_rule_views) {
+  for (int n : {1, 7, 28, 29, 40}) {
+    auto rule = oiseau::utils::integration::cubature_rule(n);
+    auto [nodes, weights] = oiseau::utils::integration::cubature(n);
+    ASSERT_EQ(rule.size(), weights.size());
+    ASSERT_EQ(rule.nodes.size(), 2 * rule.size());
+    for (std::size_t i = 0; i < rule.size(); ++i) {
+      EXPECT_EQ(rule.weights[i], weights(i));
+      EXPECT_EQ(rule.nodes[2 * i], nodes(i, 0));
+      EXPECT_EQ(rule.nodes[2 * i + 1], nodes(i, 1));
+    }
+    EXPECT_EQ(rule.nodes_view()(rule.size() - 1, 1), nodes(rule.size() - 1, 1));
+    EXPECT_DOUBLE_EQ(xt::sum(rule.weights_view())(), 2.0);
+    // no copies: later calls see the same storage
+    EXPECT_EQ(oiseau::utils::integration::cubature_rule(n).weights.data(), rule.weights.data());
+  }
+  EXPECT_THROW(oiseau::utils::integration::cubature_rule(0), std::out_of_range);
+}
+
+TEST(test_integration, test_tetrahedron_cubature) {
+  for (int n = 1; n <= 18; ++n) {
+    auto rule = oiseau::utils::integration::tetrahedron_cubature_rule(n);
+    expect_exact_3d(rule, n, integral_tetrahedron, 1e-12);
+  }
+  // Grundmann-Moller needs far fewer points than the collapsed rule at moderate orders
+  EXPECT_EQ(oiseau::utils::integration::tetrahedron_cubature_rule(5).size(), 15);
+  EXPECT_EQ(oiseau::utils::integration::tetrahedron_cubature_rule(9).size(), 70);
+  EXPECT_THROW(oiseau::utils::integration::tetrahedron_cubature_rule(0), std::out_of_range);
+}
+
+TEST(test_integration, test_hexahedron_cubature) {
+  auto exact = [](int a, int b, int c) { return integral_xn(a) * integral_xn(b) * integral_xn(c); };
+  for (int n = 1; n <= 12; ++n) {
+    auto rule = oiseau::utils::integration::hexahedron_cubature_rule(n);
+    EXPECT_EQ(rule.size(), (n / 2 + 1) * (n / 2 + 1) * (n / 2 + 1));
+    expect_exact_3d(rule, n, exact, 1e-13);
+  }
+  EXPECT_THROW(oiseau::utils::integration::hexahedron_cubature_rule(-1), std::out_of_range);
+}
@@ -7,7 +7,9 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <functional>
 #include <vector>
 
 #include "oiseau/utils/math.hpp"
@@ -35,3 +37,55 @@ TEST(test_utils, test_grad_jacobi_p) {
   auto output = oiseau::utils::grad_jacobi_p(n, alpha, beta, input);
   EXPECT_FLOATS_NEARLY_EQ(output, expected, 0.0001);
 }
+
+TEST(test_utils, test_gauss_jacobi) {
+  std::vector<double> x(4), w(4);
+  oiseau::utils::gauss_jacobi(1.0, 2.0, x, w);
+  std::vector<double> x_expected = {-0.65077886, -0.15637043, 0.37348938, 0.79729627};
+  std::vector<double> w_expected = {0.08666291, 0.44123335, 0.59015336, 0.21528371};
+  EXPECT_FLOATS_NEARLY_EQ(x, x_expected, 1e-8);
+  EXPECT_FLOATS_NEARLY_EQ(w, w_expected, 1e-8);
+}
+
+TEST(test_utils, test_gauss_jacobi_high_order) {
+  // exact for x^(2n - 2), whose integral over [-1, 1] is 2 / (2n - 1)
+  for (std::size_t n : {1, 2, 17, 300}) {
+    std::vector<double> x(n), w(n);
+    oiseau::utils::gauss_jacobi(0.0, 0.0, x, w);
+    EXPECT_TRUE(std::ranges::is_sorted(x));
+    double sum = 0.0, moment = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      sum += w[i];
+      moment += w[i] * std::pow(x[i], 2 * n - 2);
+    }
+    EXPECT_NEAR(sum, 2.0, 1e-13) << "n = " << n;
+    EXPECT_NEAR(moment, 2.0 / (2 * n - 1), 1e-14) << "n = " << n;
+  }
+}
+
+TEST(test_utils, test_gauss_jacobi_skewed_weights) {
+  // integral of (1 - x)^alpha (1 + x)^(beta + m) over [-1, 1], i.e. 2^(a + b + m + 1) B(., .)
+  auto moment = [](double alpha, double beta, int m) {
+    return std::exp((alpha + beta + m + 1) * std::log(2.0) + std::lgamma(alpha + 1) +
+                    std::lgamma(beta + m + 1) - std::lgamma(alpha + beta + m + 2));
+  };
+  struct Case {
+    double alpha, beta;
+    std::size_t n;
+  };
+  for (auto [alpha, beta, n] : {Case{5.0, 0.0, 100}, Case{0.0, 7.0, 64}, Case{12.0, 3.5, 40},
+                                Case{-0.5, 9.0, 25}}) {
+    std::vector<double> x(n), w(n);
+    oiseau::utils::gauss_jacobi(alpha, beta, x, w);
+    EXPECT_TRUE(std::ranges::adjacent_find(x, std::greater_equal<>()) == x.end())
+        << "alpha = " << alpha << ", beta = " << beta;
+    EXPECT_GT(x.front(), -1.0);
+    EXPECT_LT(x.back(), 1.0);
+    for (int m : {0, 1, 10}) {
+      double sum = 0.0;
+      for (std::size_t i = 0; i < n; ++i) sum += w[i] * std::pow(1.0 + x[i], m);
+      EXPECT_NEAR(sum / moment(alpha, beta, m), 1.0, 1e-12)
+          << "alpha = " << alpha << ", beta = " << beta << ", m = " << m;
+    }
+  }
+}